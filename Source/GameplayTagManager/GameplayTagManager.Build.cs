@@ -13,6 +13,7 @@ public class GameplayTagManager : ModuleRules
 			{
 				"Core",
 				"CoreUObject",
+				"DeveloperSettings",
 				"Engine",
 				"GameplayTags",
 				"Slate",
@@ -25,7 +26,9 @@ public class GameplayTagManager : ModuleRules
                 "EngineSettings",
 				"dbgLog",
 				"GameplayDebugger",
+				"InputCore",
 				"NetCore",
+				"TraceLog",
 			}
 		);
 	}
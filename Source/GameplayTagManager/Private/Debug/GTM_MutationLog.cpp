@@ -0,0 +1,138 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Debug/GTM_MutationLog.h"
+
+#if GTM_MUTATION_LOG_ENABLED
+#include "GameplayTagManagerModule.h"
+#include "Gameplay/Misc/GameplayTagManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+namespace GameplayTagManager::MutationLog
+{
+	int32 GLevel = static_cast<int32>(ELevel::Off);
+}
+
+namespace
+{
+	using namespace GameplayTagManager::MutationLog;
+
+	FAutoConsoleVariableRef CVarLevel(
+		TEXT("gtm.Log.Mutations"),
+		GLevel,
+		TEXT("Logs tag stack mutations. 0: off, 1: added and removed stacks, 2: count changes as well."));
+
+	struct FSamplingRule
+	{
+	public:
+		FGameplayTag Subtree;
+
+		/** One out of this many mutations is logged; 0 mutes the subtree. */
+		int32 Rate = 1;
+		uint32 Counter = 0;
+	};
+
+	FCriticalSection SamplingLock;
+	TArray<FSamplingRule> SamplingRules;
+	std::atomic<bool> bHasSamplingRules = false;
+
+	FString GSampling;
+
+	void OnSamplingChanged(IConsoleVariable*)
+	{
+		TArray<FSamplingRule> NewRules;
+
+		TArray<FString> Entries;
+		GSampling.ParseIntoArray(Entries, TEXT(","));
+		for (const FString& Entry : Entries)
+		{
+			FString TagName;
+			FString RateString;
+			if (!Entry.TrimStartAndEnd().Split(TEXT("="), &TagName, &RateString))
+			{
+				continue;
+			}
+
+			const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(*TagName, false);
+			if (!Tag.IsValid())
+			{
+				LOGV(.Category(LogGameplayTagManager).Warn(), "gtm.Log.Mutations.Sampling: unknown tag {0}",
+					TagName);
+				continue;
+			}
+
+			FSamplingRule& Rule = NewRules.AddDefaulted_GetRef();
+			Rule.Subtree = Tag;
+			Rule.Rate = FMath::Max(FCString::Atoi(*RateString), 0);
+		}
+
+		// The deepest subtree wins, so keep them sorted from the most specific one
+		NewRules.Sort([](const FSamplingRule& Lhs, const FSamplingRule& Rhs)
+		{
+			return Lhs.Subtree.GetGameplayTagParents().Num() > Rhs.Subtree.GetGameplayTagParents().Num();
+		});
+
+		FScopeLock Lock(&SamplingLock);
+		SamplingRules = MoveTemp(NewRules);
+		bHasSamplingRules = !SamplingRules.IsEmpty();
+	}
+
+	FAutoConsoleVariableRef CVarSampling(
+		TEXT("gtm.Log.Mutations.Sampling"),
+		GSampling,
+		TEXT("Comma separated Tag=Rate pairs. Mutations of a tag's subtree are logged one out of Rate times, 0 mutes "
+			"the subtree. The most specific subtree applies. E.g. \"Status=10,Status.Dead=1,Cooldown=0\"."),
+		FConsoleVariableDelegate::CreateStatic(&OnSamplingChanged));
+
+	const TCHAR* GetMutationName(const FRecord& Record)
+	{
+		if (Record.Level == ELevel::AddRemove)
+		{
+			return Record.OldCount == 0 ? TEXT("Add") : TEXT("Remove");
+		}
+
+		return TEXT("Change");
+	}
+}
+
+namespace GameplayTagManager::MutationLog
+{
+	bool PassesSampling(FGameplayTag Tag)
+	{
+		if (!bHasSamplingRules.load(std::memory_order_relaxed))
+		{
+			return true;
+		}
+
+		FScopeLock Lock(&SamplingLock);
+		for (FSamplingRule& Rule : SamplingRules)
+		{
+			if (Tag.MatchesTag(Rule.Subtree))
+			{
+				return Rule.Rate > 0 && Rule.Counter++ % Rule.Rate == 0;
+			}
+		}
+
+		return true;
+	}
+
+	void Write(const FRecord& Record)
+	{
+		const UObject* Manager = Record.Manager;
+		const FString Mutation = GetMutationName(Record);
+
+		if (Record.Level == ELevel::AddRemove)
+		{
+			LOGVSC(Manager, .Category(LogGameplayTagManager).VisualLogText(Manager, false),
+				"{0} {1} tag [Tag: {2} | Count: {3}]", Mutation, LexToString(Record.ContainerId),
+				Record.Tag.ToString(), FMath::Max(Record.OldCount, Record.NewCount));
+		}
+		else
+		{
+			LOGVSC(Manager, .Category(LogGameplayTagManager).VisualLogText(Manager, false),
+				"{0} {1} tag [Tag: {2} | Count: {3}]. Old count {4}", Mutation, LexToString(Record.ContainerId),
+				Record.Tag.ToString(), Record.NewCount, Record.OldCount);
+		}
+	}
+}
+#endif
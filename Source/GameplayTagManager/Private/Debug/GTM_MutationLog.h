@@ -0,0 +1,56 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "Gameplay/Misc/GTM_GameplayTagTypes.h"
+
+#if !defined(GTM_MUTATION_LOG_ENABLED)
+#define GTM_MUTATION_LOG_ENABLED !NO_LOGGING
+#endif
+
+#if GTM_MUTATION_LOG_ENABLED
+namespace GameplayTagManager::MutationLog
+{
+	/** Levels of gtm.Log.Mutations; each one includes the previous ones. */
+	enum class ELevel : uint8
+	{
+		Off,
+		AddRemove,
+		Change,
+	};
+
+	/** Raw fields of a stack mutation. Only turned into text once every gate passed. */
+	struct FRecord
+	{
+	public:
+		ELevel Level = ELevel::Off;
+		const UObject* Manager = nullptr;
+		EGTM_StackContainerId ContainerId = EGTM_StackContainerId::Loose;
+		FGameplayTag Tag;
+		int32 OldCount = 0;
+		int32 NewCount = 0;
+	};
+
+	extern int32 GLevel;
+
+	/** Applies the per tag subtree sampling of gtm.Log.Mutations.Sampling. Thread safe. */
+	bool PassesSampling(FGameplayTag Tag);
+
+	/** Formats the record and sends it to the output and visual logs. */
+	void Write(const FRecord& Record);
+}
+
+#define GTM_LOG_TAG_MUTATION(InLevel, InManager, InContainerId, InTag, InOldCount, InNewCount) \
+	do \
+	{ \
+		using namespace GameplayTagManager::MutationLog; \
+		if (GLevel >= static_cast<int32>(ELevel::InLevel) && PassesSampling(InTag)) \
+		{ \
+			Write({ ELevel::InLevel, InManager, InContainerId, InTag, InOldCount, InNewCount }); \
+		} \
+	} \
+	while (false)
+#else
+#define GTM_LOG_TAG_MUTATION(...)
+#endif
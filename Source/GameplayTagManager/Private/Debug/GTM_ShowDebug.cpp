@@ -5,14 +5,51 @@
 #include "DisplayDebugHelpers.h"
 #include "Engine/Canvas.h"
 #include "GameFramework/HUD.h"
+#include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
 #include "Gameplay/Misc/GameplayTagManager.h"
 
+namespace GameplayTagManager
+{
+	ETagAction FTagChangeRecord::GetAction() const
+	{
+		if (OldCount == 0)
+		{
+			return ETagAction::Added;
+		}
+
+		if (NewCount == 0)
+		{
+			return ETagAction::Removed;
+		}
+
+		return NewCount > OldCount ? ETagAction::Increased : ETagAction::Decreased;
+	}
+}
+
 #if ENABLE_DRAW_DEBUG
 namespace
 {
 	using namespace GameplayTagManager;
 
+	bool GShowOverview = false;
+	FAutoConsoleVariableRef CVarShowOverview(
+		TEXT("gtm.ShowDebug.Overview"),
+		GShowOverview,
+		TEXT("Whether ShowDebug GameplayTagManager lists every manager of the world instead of the debug target's."));
+
+	int32 GOverviewPage = 0;
+	FAutoConsoleVariableRef CVarOverviewPage(
+		TEXT("gtm.ShowDebug.Overview.Page"),
+		GOverviewPage,
+		TEXT("Page of the ShowDebug world overview to display."));
+
+	int32 GOverviewCulling = static_cast<int32>(EOverviewCulling::Distance);
+	FAutoConsoleVariableRef CVarOverviewCulling(
+		TEXT("gtm.ShowDebug.Overview.Culling"),
+		GOverviewCulling,
+		TEXT("Culling of the ShowDebug world overview. 0: None, 1: Distance, 2: View."));
+
 	constexpr FColor MainColor(255, 255, 0);
 	constexpr FColor White(255, 255, 255);
 	constexpr FColor Green(0, 255, 0);
@@ -56,78 +93,9 @@ namespace
 		}
 	}
 
-	void SerializeTagManager(FSerializedTagManagerData_Normal& InOutSerializedData)
-	{
-		if (!ensure(InOutSerializedData.TagManager.IsValid()))
-		{
-			return;
-		}
-
-		const TMap<FGameplayTag, int32>& NewTags = InOutSerializedData.TagManager->GetTagsToCount();
-
-		const float Time = InOutSerializedData.TagManager->GetWorld()->TimeSeconds;
-		if (InOutSerializedData.TrackingStartTimestamp != Time)
-		{
-			const TMap<FGameplayTag, int32>& NewTagsArray = NewTags;
-			const TMap<FGameplayTag, int32>& OldTagsArray = InOutSerializedData.LastTags;
-
-			for (const auto& [Tag, Count] : NewTagsArray)
-			{
-				if (!OldTagsArray.Contains(Tag))
-				{
-					FSerializedTagData_Normal& SerializedTag = InOutSerializedData.GetSerializedTag(Tag);
-					SerializedTag.LastAction = ETagAction::Added;
-					SerializedTag.AdditionalData = "0 -> " + FString::FromInt(Count);
-					SerializedTag.LastActionTimestamp = Time;
-				}
-			}
-
-			for (const auto& [Tag, NewCount] : NewTagsArray)
-			{
-				const auto* OldCount = OldTagsArray.Find(Tag);
-				if (OldCount && NewCount != *OldCount)
-				{
-					FSerializedTagData_Normal& SerializedTag = InOutSerializedData.GetSerializedTag(Tag);
-					SerializedTag.AdditionalData = FString::FromInt(*OldCount) + " -> " + FString::FromInt(NewCount);;
-					SerializedTag.LastActionTimestamp = Time;
-
-					if (NewCount > *OldCount)
-					{
-						SerializedTag.LastAction = ETagAction::Increased;
-					}
-					else
-					{
-						SerializedTag.LastAction = ETagAction::Decreased;
-					}
-				}
-			}
-
-			for (const auto& [Tag, Count] : OldTagsArray)
-			{
-				if (!NewTagsArray.Contains(Tag))
-				{
-					FSerializedTagData_Normal& SerializedTag = InOutSerializedData.GetSerializedTag(Tag);
-					SerializedTag.LastAction = ETagAction::Removed;
-					SerializedTag.AdditionalData = FString::FromInt(Count) + " -> 0";
-					SerializedTag.LastActionTimestamp = Time;
-				}
-			}
-		}
-		else
-		{
-			for (const auto& [Tag, NewCount] : NewTags)
-			{
-				FSerializedTagData_Normal& SerializedTag = InOutSerializedData.GetSerializedTag(Tag);
-				SerializedTag.LastAction = ETagAction::Invalid;
-				SerializedTag.LastActionTimestamp = Time;
-			}
-		}
-
-		InOutSerializedData.LastTags = NewTags;
-	}
-
-	void PrintGameplayTagManager(const FSerializedTagManagerData_Normal& Data, float CurrentTime,
-		const FShowDebugContext& InContext, FShowDebugIntermediate& InIntermediateData)
+	void PrintGameplayTagManager(const UGameplayTagManager& TagManager,
+		const TMap<FGameplayTag, const FTagChangeRecord*>& LatestRecords, float CurrentTime,
+		const FShowDebugContext& InContext)
 	{
 		FDisplayDebugManager& DisplayDebugManager = InContext.Canvas->DisplayDebugManager;
 
@@ -138,22 +106,34 @@ namespace
 			DisplayDebugManager.DrawString(String); \
 		} while(false)
 
-		PRINT(MainColor, TEXT("  Owner: %s"), *Data.TagManager->GetOwner()->GetFName().ToString());
-
-		for (const FSerializedTagData_Normal& SerializedTag : Data.SerializedTags)
+		auto PrintTag = [&](FGameplayTag Tag)
 		{
-			const FString TagString = SerializedTag.Tag.ToString();
-			const FString ActionString = LexToString(SerializedTag.LastAction);
-
-			if (SerializedTag.LastAction == ETagAction::Invalid)
+			const FTagChangeRecord* const* Record = LatestRecords.Find(Tag);
+			if (!Record)
 			{
-				PRINT(ActionToColor(SerializedTag.LastAction), TEXT("    - %s"), *TagString);
+				PRINT(ActionToColor(ETagAction::Invalid), TEXT("    - %s"), *Tag.ToString());
+				return;
 			}
-			else
+
+			const ETagAction Action = (*Record)->GetAction();
+			PRINT(ActionToColor(Action), TEXT("    - %s - %s (%.2fs) %d -> %d"), *Tag.ToString(),
+				*LexToString(Action), CurrentTime - (*Record)->Timestamp, (*Record)->OldCount, (*Record)->NewCount);
+		};
+
+		PRINT(MainColor, TEXT("  Owner: %s"), *TagManager.GetOwner()->GetFName().ToString());
+
+		const TMap<FGameplayTag, int32>& Tags = TagManager.GetTagsToCount();
+		for (const auto& [Tag, Count] : Tags)
+		{
+			PrintTag(Tag);
+		}
+
+		// Keep showing removed tags while their removal is still in the buffer
+		for (const auto& [Tag, Record] : LatestRecords)
+		{
+			if (!Tags.Contains(Tag))
 			{
-				PRINT(ActionToColor(SerializedTag.LastAction), TEXT("    - %s - %s (%.2fs) %s"),
-					*TagString, *ActionString, CurrentTime - SerializedTag.LastActionTimestamp,
-					*SerializedTag.AdditionalData);
+				PrintTag(Tag);
 			}
 		}
 
@@ -176,29 +156,28 @@ namespace GameplayTagManager
 	{
 	}
 
-	bool FSerializedTagData_Normal::operator==(const FSerializedTagData_Normal& Rhs) const
+	FGTM_ShowDebug::~FGTM_ShowDebug()
 	{
-		return Tag == Rhs.Tag;
+		StopTracking();
 	}
 
-	FSerializedTagData_Normal& FSerializedTagManagerData_Normal::GetSerializedTag(FGameplayTag InTag)
+	void FGTM_ShowDebug::ShowDebugInfo(const FShowDebugContext& InContext, FShowDebugIntermediate& InIntermediateData)
 	{
-		int32 FoundIndex = SerializedTags.Find(FSerializedTagData_Normal(InTag));
-		if (FoundIndex == INDEX_NONE)
+		// Use PIE ID to allow using the debug on every simulation separately
+		TUniquePtr<FGTM_ShowDebug>& ShowDebug = ShowDebugAcrossSimulations.FindOrAdd(UE::GetPlayInEditorID());
+		if (!ShowDebug)
 		{
-			FoundIndex = SerializedTags.Emplace(FSerializedTagData_Normal(InTag));
+			ShowDebug = MakeUnique<FGTM_ShowDebug>();
 		}
 
-		return SerializedTags[FoundIndex];
+		ShowDebug->ShowDebugInfoImpl(InContext, InIntermediateData);
 	}
 
-	void FGTM_ShowDebug::ShowDebugInfo(const FShowDebugContext& InContext, FShowDebugIntermediate& InIntermediateData)
+	void FGTM_ShowDebug::ShowDebugInfoImpl(const FShowDebugContext& InContext,
+		FShowDebugIntermediate& InIntermediateData)
 	{
 		// ShowDebug is called from each GTM, which causes it to render multiple times;
 		// keep track of the frame it was rendered from.
-		// Use PIE ID to allow using the debug on every simulation separately
-		const int32 EditorID = UE::GetPlayInEditorID();
-		uint64& LastHandledFrame = LastHandledFrameAcrossSimulations.FindOrAdd(EditorID);
 		if (LastHandledFrame == GFrameCounter)
 		{
 			return;
@@ -208,52 +187,55 @@ namespace GameplayTagManager
 		static const FName NAME_GameplayTagManager = TEXT("GameplayTagManager");
 		if (!InContext.DisplayInfo.IsDisplayOn(NAME_GameplayTagManager))
 		{
+			StopTracking();
+			return;
+		}
+
+		if (GShowOverview)
+		{
+			StopTracking();
+			DrawOverview(InContext);
 			return;
 		}
 
 		AActor* DebugTarget = InContext.HUD->GetCurrentDebugTargetActor();
 		CollectData(DebugTarget);
 		DrawData(InContext, InIntermediateData);
-		LastDebugActor = DebugTarget;
 	}
 
 	void FGTM_ShowDebug::CollectData(AActor* InDebugActor)
 	{
-		if (LastDebugActor != InDebugActor)
+		const bool bHasLostManager = TrackedManagers.ContainsByPredicate([](const FTrackedTagManager& Tracked)
+		{
+			return !Tracked.TagManager.IsValid();
+		});
+
+		if (LastDebugActor == InDebugActor && !bHasLostManager)
 		{
-			LastDebugActor = InDebugActor;
-			DebugData.Reset();
+			// Changes are being pushed to us, nothing to do
+			return;
 		}
 
-		// @todo It'd be nice if we could inspect not just pawns, but also other actors having GTM
+		StopTracking();
+		LastDebugActor = InDebugActor;
 
-		if (IsValid(InDebugActor))
+		if (!IsValid(InDebugActor))
 		{
-			const auto* ActorTagManager = InDebugActor->FindComponentByClass<UGameplayTagManager>();
-			if (IsValid(ActorTagManager))
+			return;
+		}
+
+		StartTracking(InDebugActor->FindComponentByClass<UGameplayTagManager>());
+
+		if (const auto* Pawn = Cast<APawn>(InDebugActor))
+		{
+			if (const auto* Controller = Pawn->GetController())
 			{
-				SerializeTagManager(GetDebugData(ActorTagManager));
+				StartTracking(Controller->FindComponentByClass<UGameplayTagManager>());
 			}
 
-			if (const auto* Pawn = Cast<APawn>(InDebugActor))
+			if (const auto* PlayerState = Pawn->GetPlayerState())
 			{
-				if (const auto* Controller = Pawn->GetController())
-				{
-					const auto* ControllerTagManager = Controller->FindComponentByClass<UGameplayTagManager>();
-					if (IsValid(ControllerTagManager))
-					{
-						SerializeTagManager(GetDebugData(ControllerTagManager));
-					}
-				}
-
-				if (const auto* PlayerState = Pawn->GetPlayerState())
-				{
-					const auto* PlayerStateTagManager = PlayerState->FindComponentByClass<UGameplayTagManager>();
-					if (IsValid(PlayerStateTagManager))
-					{
-						SerializeTagManager(GetDebugData(PlayerStateTagManager));
-					}
-				}
+				StartTracking(PlayerState->FindComponentByClass<UGameplayTagManager>());
 			}
 		}
 	}
@@ -271,29 +253,125 @@ namespace GameplayTagManager
 		DisplayDebugManager.DrawString(TEXT("GAMEPLAY TAG MANAGER"));
 
 		const float Time = LastDebugActor->GetWorld()->GetTimeSeconds();
-		for (const FSerializedTagManagerData_Normal& Data : DebugData)
+		for (int32 ManagerIndex = 0; ManagerIndex < TrackedManagers.Num(); ++ManagerIndex)
+		{
+			const UGameplayTagManager* TagManager = TrackedManagers[ManagerIndex].TagManager.Get();
+			if (!IsValid(TagManager))
+			{
+				continue;
+			}
+
+			// Walk from the newest record so that only the latest change of each tag is kept
+			TMap<FGameplayTag, const FTagChangeRecord*> LatestRecords;
+			for (int32 Offset = 1; Offset <= NumRecords; ++Offset)
+			{
+				const FTagChangeRecord& Record = Records[(NextRecordIndex - Offset + MaxRecords) % MaxRecords];
+				if (Record.ManagerIndex == ManagerIndex && !LatestRecords.Contains(Record.Tag))
+				{
+					LatestRecords.Add(Record.Tag, &Record);
+				}
+			}
+
+			PrintGameplayTagManager(*TagManager, LatestRecords, Time, InContext);
+		}
+	}
+
+	void FGTM_ShowDebug::DrawOverview(const FShowDebugContext& InContext)
+	{
+		const APlayerController* PlayerController = InContext.HUD->PlayerOwner;
+		if (!IsValid(PlayerController))
+		{
+			return;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		WorldOverview.SetCulling(static_cast<EOverviewCulling>(
+			FMath::Clamp(GOverviewCulling, 0, static_cast<int32>(EOverviewCulling::Num) - 1)));
+		WorldOverview.Collect(PlayerController->GetWorld(), ViewLocation, ViewRotation);
+		WorldOverview.SetPage(GOverviewPage);
+
+		FDisplayDebugManager& DisplayDebugManager = InContext.Canvas->DisplayDebugManager;
+		DisplayDebugManager.SetFont(GEngine->GetSmallFont());
+		DisplayDebugManager.SetDrawColor(MainColor);
+		DisplayDebugManager.DrawString(FString::Printf(TEXT("GAMEPLAY TAG MANAGER OVERVIEW - %d managers, page %d/%d, "
+			"culling: %s"), WorldOverview.GetNumEntries(), WorldOverview.GetPage() + 1, WorldOverview.GetNumPages(),
+			*LexToString(WorldOverview.GetCulling())));
+
+		const double Time = PlayerController->GetWorld()->GetTimeSeconds();
+		for (const FOverviewEntry& Entry : WorldOverview.GetPageEntries())
+		{
+			const UGameplayTagManager* TagManager = Entry.TagManager.Get();
+			if (!IsValid(TagManager))
+			{
+				continue;
+			}
+
+			DisplayDebugManager.SetDrawColor(MainColor);
+			DisplayDebugManager.DrawString(FString::Printf(TEXT("  Owner: %s - changed %.2fs ago, %.0f away"),
+				*TagManager->GetOwner()->GetFName().ToString(), Time - Entry.LastTagChangeTime, Entry.Distance));
+
+			DisplayDebugManager.SetDrawColor(White);
+			for (const auto& [Tag, Count] : TagManager->GetTagsToCount())
+			{
+				DisplayDebugManager.DrawString(FString::Printf(TEXT("    - %s (%d)"), *Tag.ToString(), Count));
+			}
+		}
+	}
+
+	void FGTM_ShowDebug::StartTracking(UGameplayTagManager* TagManager)
+	{
+		if (!IsValid(TagManager))
 		{
-			PrintGameplayTagManager(Data, Time, InContext, InIntermediateData);
+			return;
 		}
+
+		FTrackedTagManager& Tracked = TrackedManagers.AddDefaulted_GetRef();
+		Tracked.TagManager = TagManager;
+		Tracked.DelegateHandle = TagManager->OnTagCountChangedSimpleDelegate.AddRaw(this,
+			&FGTM_ShowDebug::OnTagCountChanged);
 	}
 
-	FSerializedTagManagerData_Normal& FGTM_ShowDebug::GetDebugData(const UGameplayTagManager* TagManager)
+	void FGTM_ShowDebug::StopTracking()
 	{
-		auto* FoundData = DebugData.FindByPredicate([TagManager](const FSerializedTagManagerData_Normal& Data)
+		for (const FTrackedTagManager& Tracked : TrackedManagers)
 		{
-			return Data.TagManager == TagManager;
+			if (UGameplayTagManager* TagManager = Tracked.TagManager.Get())
+			{
+				TagManager->OnTagCountChangedSimpleDelegate.Remove(Tracked.DelegateHandle);
+			}
+		}
+
+		TrackedManagers.Reset();
+		LastDebugActor = nullptr;
+		NextRecordIndex = 0;
+		NumRecords = 0;
+	}
+
+	void FGTM_ShowDebug::OnTagCountChanged(UGameplayTagManager* TagManager, FGameplayTag Tag, int32 OldCount,
+		int32 NewCount)
+	{
+		const int32 ManagerIndex = TrackedManagers.IndexOfByPredicate([TagManager](const FTrackedTagManager& Tracked)
+		{
+			return Tracked.TagManager == TagManager;
 		});
 
-		if (FoundData)
+		if (ManagerIndex == INDEX_NONE)
 		{
-			return *FoundData;
+			return;
 		}
 
-		FSerializedTagManagerData_Normal& Data = DebugData.AddDefaulted_GetRef();
-		Data.TagManager = TagManager;
-		Data.TrackingStartTimestamp = TagManager->GetWorld()->TimeSeconds;
+		FTagChangeRecord& Record = Records[NextRecordIndex];
+		Record.Tag = Tag;
+		Record.OldCount = OldCount;
+		Record.NewCount = NewCount;
+		Record.Timestamp = TagManager->GetWorld()->GetTimeSeconds();
+		Record.ManagerIndex = static_cast<uint8>(ManagerIndex);
 
-		return Data;
+		NextRecordIndex = (NextRecordIndex + 1) % MaxRecords;
+		NumRecords = FMath::Min(NumRecords + 1, MaxRecords);
 	}
 }
 #endif
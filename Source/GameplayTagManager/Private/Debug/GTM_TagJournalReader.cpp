@@ -0,0 +1,117 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Debug/GTM_TagJournalReader.h"
+
+#include "Gameplay/Misc/GameplayTagManager.h"
+#include "HAL/FileManager.h"
+
+namespace GameplayTagManager::TagJournal
+{
+	void FTagChangedRecord::Serialize(FArchive& Ar)
+	{
+		Ar << ManagerId;
+		Ar << TagNetIndex;
+		Ar << ContainerId;
+		Ar << OldCount;
+		Ar << NewCount;
+		Ar << Frame;
+		Ar << Time;
+	}
+
+	bool FReader::Open(const FString& FilePath)
+	{
+		Archive.Reset(IFileManager::Get().CreateFileReader(*FilePath));
+		ManagerNames.Reset();
+		TagNames.Reset();
+		NumDropped = 0;
+
+		if (!Archive)
+		{
+			UE_LOG(LogGameplayTagManager, Error, TEXT("Failed to open tag journal %s"), *FilePath);
+			return false;
+		}
+
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		*Archive << Magic;
+		*Archive << Version;
+
+		if (Magic != FileMagic || Version != FileVersion)
+		{
+			UE_LOG(LogGameplayTagManager, Error, TEXT("%s isn't a tag journal of version %u"), *FilePath, FileVersion);
+			Archive.Reset();
+			return false;
+		}
+
+		return true;
+	}
+
+	bool FReader::ReadNext(FTagChangedRecord& OutRecord)
+	{
+		while (Archive && !Archive->AtEnd() && !Archive->IsError())
+		{
+			ERecordType Type;
+			*Archive << Type;
+
+			switch (Type)
+			{
+				case ERecordType::TagChanged:
+				{
+					OutRecord.Serialize(*Archive);
+					return !Archive->IsError();
+				}
+				case ERecordType::ManagerName:
+				{
+					uint32 ManagerId;
+					FString Name;
+					*Archive << ManagerId;
+					*Archive << Name;
+					ManagerNames.Add(ManagerId, MoveTemp(Name));
+					break;
+				}
+				case ERecordType::TagName:
+				{
+					uint16 TagNetIndex;
+					FString Name;
+					*Archive << TagNetIndex;
+					*Archive << Name;
+					TagNames.Add(TagNetIndex, MoveTemp(Name));
+					break;
+				}
+				case ERecordType::Dropped:
+				{
+					uint32 Count;
+					*Archive << Count;
+					NumDropped += Count;
+					break;
+				}
+				default:
+				{
+					UE_LOG(LogGameplayTagManager, Error, TEXT("Unknown record type %d in tag journal; stopping"),
+						static_cast<int32>(Type));
+					Archive.Reset();
+					return false;
+				}
+			}
+		}
+
+		return false;
+	}
+
+	FString FReader::GetManagerName(uint32 ManagerId) const
+	{
+		const FString* Name = ManagerNames.Find(ManagerId);
+		return Name ? *Name : FString::Printf(TEXT("Unknown_%u"), ManagerId);
+	}
+
+	FString FReader::GetTagName(uint16 TagNetIndex) const
+	{
+		const FString* Name = TagNames.Find(TagNetIndex);
+		return Name ? *Name : FString::Printf(TEXT("Unknown_%u"), TagNetIndex);
+	}
+
+	uint64 FReader::GetNumDropped() const
+	{
+		return NumDropped;
+	}
+}
@@ -0,0 +1,185 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Debug/GTM_WorldOverview.h"
+
+#include "Engine/World.h"
+#include "Gameplay/Misc/GameplayTagManager.h"
+#include "Gameplay/Misc/GTM_GameplayTagManagerSubsystem.h"
+
+namespace
+{
+	int32 GManagersPerFrame = 256;
+	FAutoConsoleVariableRef CVarManagersPerFrame(
+		TEXT("gtm.Overview.ManagersPerFrame"),
+		GManagersPerFrame,
+		TEXT("Amount of managers the world overview gathers each frame."));
+
+	float GMaxDistance = 5000.f;
+	FAutoConsoleVariableRef CVarMaxDistance(
+		TEXT("gtm.Overview.MaxDistance"),
+		GMaxDistance,
+		TEXT("Managers further away from the view are culled by the Distance and View culling modes."));
+
+	float GViewHalfAngle = 45.f;
+	FAutoConsoleVariableRef CVarViewHalfAngle(
+		TEXT("gtm.Overview.ViewHalfAngle"),
+		GViewHalfAngle,
+		TEXT("Managers further than this angle in degrees from the view direction are culled by the View culling mode."));
+
+	int32 GPageSize = 10;
+	FAutoConsoleVariableRef CVarPageSize(
+		TEXT("gtm.Overview.PageSize"),
+		GPageSize,
+		TEXT("Amount of managers shown on each page of the world overview."));
+
+	int32 GetPageSize()
+	{
+		return FMath::Max(GPageSize, 1);
+	}
+}
+
+namespace GameplayTagManager
+{
+	FString LexToString(EOverviewCulling Culling)
+	{
+		switch (Culling)
+		{
+			case EOverviewCulling::None:
+				return "None";
+			case EOverviewCulling::Distance:
+				return "Distance";
+			case EOverviewCulling::View:
+				return "View";
+			default:
+				return "Invalid";
+		}
+	}
+
+	bool FGTM_WorldOverview::Collect(const UWorld* World, const FVector& ViewLocation, const FRotator& ViewRotation)
+	{
+		const auto* Subsystem = IsValid(World) ? World->GetSubsystem<UGTM_GameplayTagManagerSubsystem>() : nullptr;
+		if (!Subsystem)
+		{
+			return false;
+		}
+
+		const TArray<TWeakObjectPtr<UGameplayTagManager>>& Managers = Subsystem->GetRegisteredManagers();
+		const FVector ViewDirection = ViewRotation.Vector();
+		const float MinViewDot = FMath::Cos(FMath::DegreesToRadians(GViewHalfAngle));
+		const float MaxDistanceSquared = FMath::Square(GMaxDistance);
+
+		// Managers registered or unregistered during a pass may be skipped or seen twice; the next pass corrects it
+		const int32 EndIndex = FMath::Min(NextManagerIndex + FMath::Max(GManagersPerFrame, 1), Managers.Num());
+		for (; NextManagerIndex < EndIndex; ++NextManagerIndex)
+		{
+			const UGameplayTagManager* TagManager = Managers[NextManagerIndex].Get();
+			const AActor* Owner = IsValid(TagManager) ? TagManager->GetOwner() : nullptr;
+			if (!IsValid(Owner))
+			{
+				continue;
+			}
+
+			const FVector ToOwner = Owner->GetActorLocation() - ViewLocation;
+			const float DistanceSquared = ToOwner.SizeSquared();
+			if (Culling != EOverviewCulling::None && DistanceSquared > MaxDistanceSquared)
+			{
+				continue;
+			}
+
+			if (Culling == EOverviewCulling::View && (ToOwner.GetSafeNormal() | ViewDirection) < MinViewDot)
+			{
+				continue;
+			}
+
+			FOverviewEntry& Entry = PendingEntries.AddDefaulted_GetRef();
+			Entry.TagManager = TagManager;
+			Entry.LastTagChangeTime = TagManager->GetLastTagChangeTime();
+			Entry.Distance = FMath::Sqrt(DistanceSquared);
+		}
+
+		if (NextManagerIndex < Managers.Num())
+		{
+			return false;
+		}
+
+		PendingEntries.Sort([](const FOverviewEntry& Lhs, const FOverviewEntry& Rhs)
+		{
+			return Lhs.LastTagChangeTime > Rhs.LastTagChangeTime;
+		});
+
+		Swap(Entries, PendingEntries);
+		PendingEntries.Reset();
+		NextManagerIndex = 0;
+		Page = FMath::Min(Page, GetNumPages() - 1);
+
+		return true;
+	}
+
+	void FGTM_WorldOverview::Reset()
+	{
+		Entries.Reset();
+		PendingEntries.Reset();
+		NextManagerIndex = 0;
+		Page = 0;
+	}
+
+	void FGTM_WorldOverview::SetCulling(EOverviewCulling InCulling)
+	{
+		if (Culling != InCulling)
+		{
+			Culling = InCulling;
+
+			// Restart the pass so that it doesn't mix the modes
+			PendingEntries.Reset();
+			NextManagerIndex = 0;
+		}
+	}
+
+	EOverviewCulling FGTM_WorldOverview::GetCulling() const
+	{
+		return Culling;
+	}
+
+	void FGTM_WorldOverview::CycleCulling()
+	{
+		const int32 NumModes = static_cast<int32>(EOverviewCulling::Num);
+		SetCulling(static_cast<EOverviewCulling>((static_cast<int32>(Culling) + 1) % NumModes));
+	}
+
+	void FGTM_WorldOverview::SetPage(int32 InPage)
+	{
+		Page = FMath::Clamp(InPage, 0, GetNumPages() - 1);
+	}
+
+	void FGTM_WorldOverview::NextPage()
+	{
+		Page = (Page + 1) % GetNumPages();
+	}
+
+	void FGTM_WorldOverview::PreviousPage()
+	{
+		Page = (Page - 1 + GetNumPages()) % GetNumPages();
+	}
+
+	int32 FGTM_WorldOverview::GetPage() const
+	{
+		return Page;
+	}
+
+	int32 FGTM_WorldOverview::GetNumPages() const
+	{
+		return FMath::Max(FMath::DivideAndRoundUp(Entries.Num(), GetPageSize()), 1);
+	}
+
+	TConstArrayView<FOverviewEntry> FGTM_WorldOverview::GetPageEntries() const
+	{
+		const int32 FirstIndex = Page * GetPageSize();
+		const int32 NumEntries = FMath::Clamp(Entries.Num() - FirstIndex, 0, GetPageSize());
+		return TConstArrayView<FOverviewEntry>(Entries.GetData() + FirstIndex, NumEntries);
+	}
+
+	int32 FGTM_WorldOverview::GetNumEntries() const
+	{
+		return Entries.Num();
+	}
+}
@@ -5,183 +5,205 @@
 #if WITH_GAMEPLAY_DEBUGGER
 
 #include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
 #include "Gameplay/Misc/GameplayTagManager.h"
+#include "GameplayTagsManager.h"
+#include "InputCoreTypes.h"
 
 namespace GameplayTagManager
 {
-	void FRepSerializedTagData::Serialize(FArchive& Ar)
+	constexpr int32 MaxHistoryLength = 10;
+	constexpr float MaxHistoryAge = 10.f;
+
+	static void SerializeTag(FArchive& Ar, FGameplayTag& Tag)
 	{
-		Ar << Tag;
-		Ar << Action;
-		Ar << ActionTimestamp;
-		Ar << AdditionalData;
+		// Both sides share the tag net index table, send the index instead of the name
+		UGameplayTagsManager& TagsManager = UGameplayTagsManager::Get();
+		FGameplayTagNetIndex NetIndex = Ar.IsSaving() ? TagsManager.GetNetIndexFromTag(Tag) : INVALID_TAGNETINDEX;
+		Ar << NetIndex;
+
+		if (Ar.IsLoading())
+		{
+			Tag = TagsManager.GetTagFromNetIndex(NetIndex);
+		}
 	}
 
-	void FRepSerializedTagManagerData::FGameplayTagCountPair::Serialize(FArchive& Ar)
+	static void SerializeCount(FArchive& Ar, int32& Count)
 	{
-		Ar << Tag;
-		Ar << Count;
+		uint32 PackedCount = static_cast<uint32>(Count);
+		Ar.SerializeIntPacked(PackedCount);
+		Count = static_cast<int32>(PackedCount);
 	}
 
-	void FRepSerializedTagManagerData::Serialize(FArchive& Ar)
+	void FRepRecordsData::Serialize(FArchive& Ar)
 	{
-		Ar << FirstSerializationTimestamp;
-		Ar << TagManagerOwnerName;
+		Ar << NextSequence;
+		Ar << NumRecords;
 
-		if (Ar.IsSaving())
+		if (Ar.IsLoading())
 		{
-			int32 Num = SerializedTags.Num();
-			Ar << Num;
-
-			for (FRepSerializedTagData& Data : SerializedTags)
-			{
-				Data.Serialize(Ar);
-			}
+			NumRecords = FMath::Clamp(NumRecords, 0, MaxRecords);
 		}
-		else
-		{
-			int32 Num;
-			Ar << Num;
 
-			SerializedTags.Reset(Num);
-			for (int32 i = 0; i < Num; ++i)
-			{
-				SerializedTags.AddDefaulted_GetRef().Serialize(Ar);
-			}
-		}
-
-		if (Ar.IsSaving())
+		// Always written from the oldest to the newest, so the loaded buffer starts at index 0
+		const int32 FirstIndex = Ar.IsSaving() ? (NextRecordIndex - NumRecords + MaxRecords) % MaxRecords : 0;
+		for (int32 i = 0; i < NumRecords; ++i)
 		{
-			int32 Num = LastTags.Num();
-			Ar << Num;
-
-			for (auto& Pair : LastTags)
-			{
-				FGameplayTag Tag = Pair.Key;
-				int32 Value = Pair.Value;
-
-				Ar << Tag;
-				Ar << Value;
-			}
+			FTagChangeRecord& Record = Records[(FirstIndex + i) % MaxRecords];
+			SerializeTag(Ar, Record.Tag);
+			SerializeCount(Ar, Record.OldCount);
+			SerializeCount(Ar, Record.NewCount);
+			Ar << Record.Timestamp;
+			Ar << Record.ManagerIndex;
 		}
-		else
-		{
-			int32 Num;
-			Ar << Num;
-
-			LastTags.Reset();
-			LastTags.Reserve(Num);
-			for (int32 i = 0; i < Num; ++i)
-			{
-				FGameplayTag Tag;
-				int32 Value;
-
-				Ar << Tag;
-				Ar << Value;
-
-				LastTags.Emplace(Tag, Value);
-			}
-		}
-	}
-
-	void FRepData::Serialize(FArchive& Ar)
-	{
-		int32 Num = DebugData.Num();
-		Ar << Num;
 
 		if (Ar.IsLoading())
 		{
-			DebugData.SetNum(Num);
+			NextRecordIndex = NumRecords % MaxRecords;
 		}
+	}
 
-		for (int32 i = 0; i < Num; i++)
-		{
-			DebugData[i].Serialize(Ar);
-		}
+	void FRepRecordsData::AddRecord(const FTagChangeRecord& Record)
+	{
+		Records[NextRecordIndex] = Record;
+		NextRecordIndex = (NextRecordIndex + 1) % MaxRecords;
+		NumRecords = FMath::Min(NumRecords + 1, MaxRecords);
+		NextSequence++;
 	}
 
-	FGameplayDebuggerCategory_GameplayTags::FGameplayDebuggerCategory_GameplayTags()
+	void FRepRecordsData::Reset()
 	{
-		bShowOnlyWithDebugActor = false;
+		NextRecordIndex = 0;
+		NumRecords = 0;
+		NextSequence = 0;
+	}
 
-		SetDataPackReplication<FRepData>(&DataPack, EGameplayDebuggerDataPack::ResetOnActorChange);
+	const FTagChangeRecord& FRepRecordsData::GetRecord(int32 Index) const
+	{
+		check(Index >= 0 && Index < NumRecords);
+		return Records[(NextRecordIndex - NumRecords + Index + MaxRecords) % MaxRecords];
 	}
 
-	TSharedRef<FGameplayDebuggerCategory> FGameplayDebuggerCategory_GameplayTags::MakeInstance()
+	uint32 FRepRecordsData::GetRecordSequence(int32 Index) const
 	{
-		return MakeShareable(new FGameplayDebuggerCategory_GameplayTags());
+		return NextSequence - NumRecords + Index;
 	}
 
-	static void SerializeTagManager(FRepSerializedTagManagerData& InOutSerializedData)
+	void FRepSnapshotData::Serialize(FArchive& Ar)
 	{
-		if (!ensure(InOutSerializedData.TagManager.IsValid()))
+		Ar << Sequence;
+
+		int32 NumManagers = Managers.Num();
+		Ar << NumManagers;
+
+		if (Ar.IsLoading())
 		{
-			return;
+			Managers.SetNum(NumManagers);
 		}
 
-		const TMap<FGameplayTag, int32>& NewTags = InOutSerializedData.TagManager->GetTagsToCount();
-
-		const float Time = InOutSerializedData.TagManager->GetWorld()->TimeSeconds;
-		if (InOutSerializedData.FirstSerializationTimestamp != Time)
+		for (FManagerSnapshot& Manager : Managers)
 		{
-			const TMap<FGameplayTag, int32>& NewTagsArray = NewTags;
-			const TMap<FGameplayTag, int32>& OldTagsArray = InOutSerializedData.LastTags;
+			Ar << Manager.OwnerName;
 
-			for (const auto& [Tag, Count] : NewTagsArray)
-			{
-				if (!OldTagsArray.Contains(Tag))
-				{
-					FRepSerializedTagData Data(Tag, ETagAction::Added, Time, "0 -> " + FString::FromInt(Count));
-					InOutSerializedData.SerializedTags.EmplaceAt(0, Data);
-				}
-			}
+			int32 NumTags = Manager.TagsToCount.Num();
+			Ar << NumTags;
 
-			for (const auto& [Tag, NewCount] : NewTagsArray)
+			if (Ar.IsSaving())
 			{
-				const auto* OldCount = OldTagsArray.Find(Tag);
-				if (OldCount && NewCount != *OldCount)
+				for (auto& [Tag, Count] : Manager.TagsToCount)
 				{
-					const FString AdditionalData = FString::FromInt(*OldCount) + " -> " + FString::FromInt(NewCount);
-					if (NewCount > *OldCount)
-					{
-						FRepSerializedTagData Data(Tag, ETagAction::Increased, Time, AdditionalData);
-						InOutSerializedData.SerializedTags.EmplaceAt(0, Data);
-					}
-					else
-					{
-						FRepSerializedTagData Data(Tag, ETagAction::Decreased, Time, AdditionalData);
-						InOutSerializedData.SerializedTags.EmplaceAt(0, Data);
-					}
+					FGameplayTag TagCopy = Tag;
+					SerializeTag(Ar, TagCopy);
+					SerializeCount(Ar, Count);
 				}
 			}
-
-			for (const auto& [Tag, Count] : OldTagsArray)
+			else
 			{
-				if (!NewTagsArray.Contains(Tag))
+				Manager.TagsToCount.Reset();
+				Manager.TagsToCount.Reserve(NumTags);
+				for (int32 i = 0; i < NumTags; ++i)
 				{
-					FRepSerializedTagData Data(Tag, ETagAction::Removed, Time, FString::FromInt(Count) + " -> 0");
-					InOutSerializedData.SerializedTags.EmplaceAt(0, Data);
+					FGameplayTag Tag;
+					int32 Count = 0;
+					SerializeTag(Ar, Tag);
+					SerializeCount(Ar, Count);
+
+					Manager.TagsToCount.Emplace(Tag, Count);
 				}
 			}
+		}
+	}
+
+	void FRepOverviewData::Serialize(FArchive& Ar)
+	{
+		Ar << bIsEnabled;
+		Ar << Culling;
+		Ar << NumManagers;
+		Ar << Page;
+		Ar << NumPages;
+
+		int32 NumEntries = Entries.Num();
+		Ar << NumEntries;
+
+		if (Ar.IsLoading())
+		{
+			Entries.SetNum(NumEntries);
+		}
+
+		for (FEntry& Entry : Entries)
+		{
+			Ar << Entry.OwnerName;
+			Ar << Entry.LastTagChangeTime;
+			SerializeCount(Ar, Entry.Distance);
+			SerializeCount(Ar, Entry.NumTags);
 
-			// Trim the history if it's too long
-			constexpr int32 MaxHistoryLength = 10;
-			auto& Container = InOutSerializedData.SerializedTags;
-			const int32 ToRemove = Container.Num() - MaxHistoryLength;
-			if (ToRemove > 0)
+			uint8 NumSentTags = static_cast<uint8>(Entry.Tags.Num());
+			Ar << NumSentTags;
+
+			if (Ar.IsLoading())
 			{
-				Container.SetNum(MaxHistoryLength);
+				Entry.Tags.SetNum(FMath::Min<int32>(NumSentTags, MaxTagsPerEntry));
 			}
 
-			// Delete entries that are too old
-			Container.RemoveAll([Time](const FRepSerializedTagData& Data)
+			for (FGameplayTag& Tag : Entry.Tags)
 			{
-				return (Time - Data.ActionTimestamp) > 10.f;
-			});
+				SerializeTag(Ar, Tag);
+			}
 		}
+	}
+
+	FGameplayDebuggerCategory_GameplayTags::FGameplayDebuggerCategory_GameplayTags()
+	{
+		bShowOnlyWithDebugActor = false;
+
+		// Records change with every tag change while the snapshot only does once in a while; having them in separate
+		// data packs avoids sending the counts along with each new record
+		SetDataPackReplication<FRepRecordsData>(&RecordsPack, EGameplayDebuggerDataPack::ResetOnActorChange);
+		SetDataPackReplication<FRepSnapshotData>(&SnapshotPack, EGameplayDebuggerDataPack::ResetOnActorChange);
+		SetDataPackReplication<FRepOverviewData>(&OverviewPack);
+
+		// The overview is gathered server-side, so the input has to get there
+		constexpr auto Replicated = EGameplayDebuggerInputMode::Replicated;
+		const FGameplayDebuggerInputModifier& Shift = FGameplayDebuggerInputModifier::Shift;
+		BindKeyPress(EKeys::O.GetFName(), Shift, this,
+			&FGameplayDebuggerCategory_GameplayTags::OnToggleOverview, Replicated);
+		BindKeyPress(EKeys::C.GetFName(), Shift, this,
+			&FGameplayDebuggerCategory_GameplayTags::OnCycleCulling, Replicated);
+		BindKeyPress(EKeys::PageDown.GetFName(), Shift, this,
+			&FGameplayDebuggerCategory_GameplayTags::OnNextPage, Replicated);
+		BindKeyPress(EKeys::PageUp.GetFName(), Shift, this,
+			&FGameplayDebuggerCategory_GameplayTags::OnPreviousPage, Replicated);
+	}
 
-		InOutSerializedData.LastTags = NewTags;
+	FGameplayDebuggerCategory_GameplayTags::~FGameplayDebuggerCategory_GameplayTags()
+	{
+		StopTracking();
+	}
+
+	TSharedRef<FGameplayDebuggerCategory> FGameplayDebuggerCategory_GameplayTags::MakeInstance()
+	{
+		return MakeShareable(new FGameplayDebuggerCategory_GameplayTags());
 	}
 
 	constexpr FColor White(255, 255, 255);
@@ -211,40 +233,47 @@ namespace GameplayTagManager
 
 	void FGameplayDebuggerCategory_GameplayTags::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
 	{
-		if (LastDebugActor != DebugActor)
+		if (OverviewPack.bIsEnabled)
 		{
-			LastDebugActor = DebugActor;
-			DataPack.DebugData.Reset();
+			CollectOverview(OwnerPC);
 		}
 
-		if (IsValid(DebugActor))
+		const bool bHasLostManager = TrackedManagers.ContainsByPredicate([](const FTrackedTagManager& Tracked)
 		{
-			const auto* ActorTagManager = DebugActor->FindComponentByClass<UGameplayTagManager>();
-			if (IsValid(ActorTagManager))
-			{
-				SerializeTagManager(GetDebugData(ActorTagManager));
-			}
+			return !Tracked.TagManager.IsValid();
+		});
+
+		if (LastDebugActor != DebugActor || bHasLostManager)
+		{
+			StopTracking();
+			LastDebugActor = DebugActor;
 
-			if (const auto* Pawn = Cast<APawn>(DebugActor))
+			if (IsValid(DebugActor))
 			{
-				if (const auto* Controller = Pawn->GetController())
+				StartTracking(DebugActor->FindComponentByClass<UGameplayTagManager>());
+
+				if (const auto* Pawn = Cast<APawn>(DebugActor))
 				{
-					const auto* ControllerTagManager = Controller->FindComponentByClass<UGameplayTagManager>();
-					if (IsValid(ControllerTagManager))
+					if (const auto* Controller = Pawn->GetController())
 					{
-						SerializeTagManager(GetDebugData(ControllerTagManager));
+						StartTracking(Controller->FindComponentByClass<UGameplayTagManager>());
 					}
-				}
 
-				if (const auto* PlayerState = Pawn->GetPlayerState())
-				{
-					const auto* PlayerStateTagManager = PlayerState->FindComponentByClass<UGameplayTagManager>();
-					if (IsValid(PlayerStateTagManager))
+					if (const auto* PlayerState = Pawn->GetPlayerState())
 					{
-						SerializeTagManager(GetDebugData(PlayerStateTagManager));
+						StartTracking(PlayerState->FindComponentByClass<UGameplayTagManager>());
 					}
 				}
 			}
+
+			TakeSnapshot();
+			return;
+		}
+
+		// Records newer than the snapshot have to stay in the buffer for the client to rebuild the counts
+		if (RecordsPack.NextSequence - SnapshotPack.Sequence >= FRepRecordsData::MaxRecords / 2)
+		{
+			TakeSnapshot();
 		}
 	}
 
@@ -265,8 +294,9 @@ namespace GameplayTagManager
 		}
 	}
 
-	static float PrintGameplayTagManager(const FRepSerializedTagManagerData& Data,
-		FGameplayDebuggerCanvasContext& CanvasContext, float CursorX, float CurrentTime)
+	static float PrintGameplayTagManager(const FRepSnapshotData::FManagerSnapshot& Snapshot, uint8 ManagerIndex,
+		const FRepRecordsData& Records, uint32 SnapshotSequence, FGameplayDebuggerCanvasContext& CanvasContext,
+		float CursorX, float CurrentTime)
 	{
 		float MaxCursorX = CursorX;
 
@@ -281,37 +311,83 @@ namespace GameplayTagManager
 			MaxCursorX = FMath::Max(MaxCursorX, CursorX + SizeX); \
 		} while(false)
 
-		PRINT(FColor::Orange, TEXT("Tag manager owner: %s"), *Data.TagManagerOwnerName);
+		// Bring the snapshot up to date with the records received after it
+		TMap<FGameplayTag, int32> TagsToCount = Snapshot.TagsToCount;
+		for (int32 i = 0; i < Records.NumRecords; ++i)
+		{
+			const FTagChangeRecord& Record = Records.GetRecord(i);
+			const bool bIsInSnapshot = static_cast<int32>(Records.GetRecordSequence(i) - SnapshotSequence) < 0;
+			if (Record.ManagerIndex != ManagerIndex || bIsInSnapshot)
+			{
+				continue;
+			}
+
+			if (Record.NewCount > 0)
+			{
+				TagsToCount.Add(Record.Tag, Record.NewCount);
+			}
+			else
+			{
+				TagsToCount.Remove(Record.Tag);
+			}
+		}
+
+		PRINT(FColor::Orange, TEXT("Tag manager owner: %s"), *Snapshot.OwnerName);
 
 		CanvasContext.MoveToNewLine();
 		PRINT(FColor::White, TEXT("Tags:"));
-		for (const auto& [Tag, Count] : Data.LastTags)
+		for (const auto& [Tag, Count] : TagsToCount)
 		{
 			PRINT(FColor::White, TEXT("- %s (%d)"), *Tag.ToString(), Count);
 		}
 
 		CanvasContext.MoveToNewLine();
 		PRINT(FColor::White, TEXT("Tag actions:"));
-		for (const FRepSerializedTagData& SerializedTag : Data.SerializedTags)
+
+		int32 NumPrinted = 0;
+		for (int32 i = Records.NumRecords - 1; i >= 0 && NumPrinted < MaxHistoryLength; --i)
 		{
-			const FString TagString = SerializedTag.Tag.ToString();
-			const FString ActionString = LexToString(SerializedTag.Action);
+			const FTagChangeRecord& Record = Records.GetRecord(i);
+			if (CurrentTime - Record.Timestamp > MaxHistoryAge)
+			{
+				break;
+			}
+
+			if (Record.ManagerIndex != ManagerIndex)
+			{
+				continue;
+			}
 
-			PRINT(ActionToColor(SerializedTag.Action), TEXT("- %s - %s (%.2fs) %s"),
-				*TagString, *ActionString, CurrentTime - SerializedTag.ActionTimestamp, *SerializedTag.AdditionalData);
+			const ETagAction Action = Record.GetAction();
+			PRINT(ActionToColor(Action), TEXT("- %s - %s (%.2fs) %d -> %d"), *Record.Tag.ToString(),
+				*LexToString(Action), CurrentTime - Record.Timestamp, Record.OldCount, Record.NewCount);
+			NumPrinted++;
 		}
 
+#undef PRINT
+
 		return MaxCursorX;
 	}
 
 	void FGameplayDebuggerCategory_GameplayTags::DrawData(APlayerController* OwnerPC,
 		FGameplayDebuggerCanvasContext& CanvasContext)
 	{
+		CanvasContext.Printf(TEXT("[{yellow}%s{white}]: Toggle world overview  [{yellow}%s{white}]: Cycle culling  "
+			"[{yellow}%s{white}]/[{yellow}%s{white}]: Next/previous page"), *GetInputHandlerDescription(0),
+			*GetInputHandlerDescription(1), *GetInputHandlerDescription(2), *GetInputHandlerDescription(3));
+
+		if (OverviewPack.bIsEnabled)
+		{
+			DrawOverview(OwnerPC, CanvasContext);
+			return;
+		}
+
 		float MaxCursorX = 0.f;
 		const float Time = OwnerPC->GetWorld()->GetGameState()->GetServerWorldTimeSeconds();
-		for (FRepSerializedTagManagerData& Data : DataPack.DebugData)
+		for (int32 i = 0; i < SnapshotPack.Managers.Num(); ++i)
 		{
-			MaxCursorX = PrintGameplayTagManager(Data, CanvasContext, MaxCursorX, Time);
+			MaxCursorX = PrintGameplayTagManager(SnapshotPack.Managers[i], static_cast<uint8>(i), RecordsPack,
+				SnapshotPack.Sequence, CanvasContext, MaxCursorX, Time);
 			CanvasContext.CursorY = CanvasContext.DefaultY + CanvasContext.GetLineHeight();
 			MaxCursorX += 100.f;
 		}
@@ -322,25 +398,177 @@ namespace GameplayTagManager
 		MarkRenderStateDirty();
 	}
 
-	FRepSerializedTagManagerData& FGameplayDebuggerCategory_GameplayTags::GetDebugData(
-		const UGameplayTagManager* TagManager)
+	void FGameplayDebuggerCategory_GameplayTags::CollectOverview(APlayerController* OwnerPC)
 	{
-		auto* FoundData = DataPack.DebugData.FindByPredicate([TagManager](const FRepSerializedTagManagerData& Data)
+		if (!IsValid(OwnerPC))
 		{
-			return Data.TagManager == TagManager;
+			return;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		OwnerPC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		if (WorldOverview.Collect(OwnerPC->GetWorld(), ViewLocation, ViewRotation))
+		{
+			UpdateOverviewPack();
+		}
+	}
+
+	void FGameplayDebuggerCategory_GameplayTags::UpdateOverviewPack()
+	{
+		OverviewPack.NumManagers = WorldOverview.GetNumEntries();
+		OverviewPack.Page = WorldOverview.GetPage();
+		OverviewPack.NumPages = WorldOverview.GetNumPages();
+		OverviewPack.Culling = WorldOverview.GetCulling();
+		OverviewPack.Entries.Reset();
+
+		for (const FOverviewEntry& Entry : WorldOverview.GetPageEntries())
+		{
+			const UGameplayTagManager* TagManager = Entry.TagManager.Get();
+			if (!IsValid(TagManager))
+			{
+				continue;
+			}
+
+			const TMap<FGameplayTag, int32>& TagsToCount = TagManager->GetTagsToCount();
+
+			FRepOverviewData::FEntry& PackEntry = OverviewPack.Entries.AddDefaulted_GetRef();
+			PackEntry.OwnerName = TagManager->GetOwner()->GetName();
+			PackEntry.LastTagChangeTime = Entry.LastTagChangeTime;
+			PackEntry.Distance = FMath::RoundToInt(Entry.Distance);
+			PackEntry.NumTags = TagsToCount.Num();
+
+			for (const auto& [Tag, Count] : TagsToCount)
+			{
+				if (PackEntry.Tags.Num() == FRepOverviewData::MaxTagsPerEntry)
+				{
+					break;
+				}
+
+				PackEntry.Tags.Add(Tag);
+			}
+		}
+	}
+
+	void FGameplayDebuggerCategory_GameplayTags::DrawOverview(APlayerController* OwnerPC,
+		FGameplayDebuggerCanvasContext& CanvasContext)
+	{
+		CanvasContext.Printf(TEXT("{orange}World overview{white} - %d managers, page %d/%d, culling: %s"),
+			OverviewPack.NumManagers, OverviewPack.Page + 1, OverviewPack.NumPages, *LexToString(OverviewPack.Culling));
+
+		const float Time = OwnerPC->GetWorld()->GetGameState()->GetServerWorldTimeSeconds();
+		for (const FRepOverviewData::FEntry& Entry : OverviewPack.Entries)
+		{
+			FString TagsString;
+			for (const FGameplayTag& Tag : Entry.Tags)
+			{
+				TagsString += TagsString.IsEmpty() ? Tag.ToString() : TEXT(", ") + Tag.ToString();
+			}
+
+			if (Entry.NumTags > Entry.Tags.Num())
+			{
+				TagsString += FString::Printf(TEXT(" and %d more"), Entry.NumTags - Entry.Tags.Num());
+			}
+
+			CanvasContext.Printf(TEXT("{yellow}%s{white} - changed %.2fs ago, %d away: %s"), *Entry.OwnerName,
+				Time - Entry.LastTagChangeTime, Entry.Distance, *TagsString);
+		}
+	}
+
+	void FGameplayDebuggerCategory_GameplayTags::OnToggleOverview()
+	{
+		OverviewPack.bIsEnabled = !OverviewPack.bIsEnabled;
+		if (!OverviewPack.bIsEnabled)
+		{
+			WorldOverview.Reset();
+			OverviewPack.Entries.Reset();
+		}
+	}
+
+	void FGameplayDebuggerCategory_GameplayTags::OnCycleCulling()
+	{
+		WorldOverview.CycleCulling();
+		UpdateOverviewPack();
+	}
+
+	void FGameplayDebuggerCategory_GameplayTags::OnNextPage()
+	{
+		WorldOverview.NextPage();
+		UpdateOverviewPack();
+	}
+
+	void FGameplayDebuggerCategory_GameplayTags::OnPreviousPage()
+	{
+		WorldOverview.PreviousPage();
+		UpdateOverviewPack();
+	}
+
+	void FGameplayDebuggerCategory_GameplayTags::StartTracking(UGameplayTagManager* TagManager)
+	{
+		if (!IsValid(TagManager))
+		{
+			return;
+		}
+
+		FTrackedTagManager& Tracked = TrackedManagers.AddDefaulted_GetRef();
+		Tracked.TagManager = TagManager;
+		Tracked.DelegateHandle = TagManager->OnTagCountChangedSimpleDelegate.AddRaw(this,
+			&FGameplayDebuggerCategory_GameplayTags::OnTagCountChanged);
+	}
+
+	void FGameplayDebuggerCategory_GameplayTags::StopTracking()
+	{
+		for (const FTrackedTagManager& Tracked : TrackedManagers)
+		{
+			if (UGameplayTagManager* TagManager = Tracked.TagManager.Get())
+			{
+				TagManager->OnTagCountChangedSimpleDelegate.Remove(Tracked.DelegateHandle);
+			}
+		}
+
+		TrackedManagers.Reset();
+		LastDebugActor = nullptr;
+		RecordsPack.Reset();
+	}
+
+	void FGameplayDebuggerCategory_GameplayTags::TakeSnapshot()
+	{
+		SnapshotPack.Sequence = RecordsPack.NextSequence;
+		SnapshotPack.Managers.Reset();
+
+		for (const FTrackedTagManager& Tracked : TrackedManagers)
+		{
+			FRepSnapshotData::FManagerSnapshot& Snapshot = SnapshotPack.Managers.AddDefaulted_GetRef();
+			if (const UGameplayTagManager* TagManager = Tracked.TagManager.Get())
+			{
+				Snapshot.OwnerName = TagManager->GetOwner()->GetName();
+				Snapshot.TagsToCount = TagManager->GetTagsToCount();
+			}
+		}
+	}
+
+	void FGameplayDebuggerCategory_GameplayTags::OnTagCountChanged(UGameplayTagManager* TagManager, FGameplayTag Tag,
+		int32 OldCount, int32 NewCount)
+	{
+		const int32 ManagerIndex = TrackedManagers.IndexOfByPredicate([TagManager](const FTrackedTagManager& Tracked)
+		{
+			return Tracked.TagManager == TagManager;
 		});
 
-		if (FoundData)
+		if (ManagerIndex == INDEX_NONE)
 		{
-			return *FoundData;
+			return;
 		}
 
-		FRepSerializedTagManagerData& Data = DataPack.DebugData.AddDefaulted_GetRef();
-		Data.TagManager = TagManager;
-		Data.FirstSerializationTimestamp = TagManager->GetWorld()->TimeSeconds;
-		Data.TagManagerOwnerName = TagManager->GetOwner()->GetName();
+		FTagChangeRecord Record;
+		Record.Tag = Tag;
+		Record.OldCount = OldCount;
+		Record.NewCount = NewCount;
+		Record.Timestamp = TagManager->GetWorld()->GetTimeSeconds();
+		Record.ManagerIndex = static_cast<uint8>(ManagerIndex);
 
-		return Data;
+		RecordsPack.AddRecord(Record);
 	}
 }
 #endif
@@ -6,57 +6,88 @@
 
 #include "GameplayDebuggerCategory.h"
 #include "Debug/GTM_ShowDebug.h"
+#include "Debug/GTM_WorldOverview.h"
 
 class UGameplayTagManager;
 
 #if WITH_GAMEPLAY_DEBUGGER
 namespace GameplayTagManager
 {
-	struct FRepSerializedTagData
+	/** Latest tag changes of the tracked managers, packed and kept in a fixed ring buffer. */
+	struct FRepRecordsData
 	{
+	public:
+		static constexpr int32 MaxRecords = 64;
+
 	public:
 		void Serialize(FArchive& Ar);
 
+		void AddRecord(const FTagChangeRecord& Record);
+		void Reset();
+
+		/** Returns the record at the given position, where 0 is the oldest one. */
+		const FTagChangeRecord& GetRecord(int32 Index) const;
+		uint32 GetRecordSequence(int32 Index) const;
+
 	public:
-		FGameplayTag Tag;
-		ETagAction Action = ETagAction::Invalid;
-		float ActionTimestamp = 0.f;
-		FString AdditionalData;
+		TStaticArray<FTagChangeRecord, MaxRecords> Records;
+		int32 NextRecordIndex = 0;
+		int32 NumRecords = 0;
+
+		/** Sequence number the next record will be given. */
+		uint32 NextSequence = 0;
 	};
 
-	struct FRepSerializedTagManagerData
+	/**
+	 * Tag counts of the tracked managers at some point in time. Refreshed only every once in a while, the client
+	 * applies the newer records on top of it.
+	 */
+	struct FRepSnapshotData
 	{
 	public:
-		struct FGameplayTagCountPair
+		struct FManagerSnapshot
 		{
 		public:
-			void Serialize(FArchive& Ar);
-
-		public:
-			FGameplayTag Tag;
-			int32 Count = 0;
+			FString OwnerName;
+			TMap<FGameplayTag, int32> TagsToCount;
 		};
 
 	public:
 		void Serialize(FArchive& Ar);
 
 	public:
-		TWeakObjectPtr<const UGameplayTagManager> TagManager = nullptr;
-		TMap<FGameplayTag, int32> LastTags;
-		float FirstSerializationTimestamp = 0.f;
+		TArray<FManagerSnapshot, TInlineAllocator<3>> Managers;
 
-		FString TagManagerOwnerName;
-		TArray<FRepSerializedTagData> SerializedTags;
-		TArray<FGameplayTagCountPair> ReplicatedLastTags;
+		/** Sequence of the first record that isn't accounted for in the counts. */
+		uint32 Sequence = 0;
 	};
 
-	struct FRepData
+	/** Current page of the world overview. Only the first tags of each manager are sent. */
+	struct FRepOverviewData
 	{
+	public:
+		static constexpr int32 MaxTagsPerEntry = 8;
+
+		struct FEntry
+		{
+		public:
+			FString OwnerName;
+			float LastTagChangeTime = 0.f;
+			int32 Distance = 0;
+			int32 NumTags = 0;
+			TArray<FGameplayTag, TInlineAllocator<MaxTagsPerEntry>> Tags;
+		};
+
 	public:
 		void Serialize(FArchive& Ar);
 
 	public:
-		TArray<FRepSerializedTagManagerData> DebugData;
+		TArray<FEntry> Entries;
+		int32 NumManagers = 0;
+		int32 Page = 0;
+		int32 NumPages = 0;
+		EOverviewCulling Culling = EOverviewCulling::None;
+		bool bIsEnabled = false;
 	};
 
 	class FGameplayDebuggerCategory_GameplayTags
@@ -64,6 +95,7 @@ namespace GameplayTagManager
 	{
 	public:
 		FGameplayDebuggerCategory_GameplayTags();
+		virtual ~FGameplayDebuggerCategory_GameplayTags() override;
 
 		/** Creates an instance of this category - will be used on module startup to include our category in the Editor */
 		static TSharedRef<FGameplayDebuggerCategory> MakeInstance();
@@ -75,12 +107,29 @@ namespace GameplayTagManager
 		//~End of FGameplayDebuggerCategory Interface
 
 	private:
-		FRepSerializedTagManagerData& GetDebugData(const UGameplayTagManager* TagManager);
+		void CollectOverview(APlayerController* OwnerPC);
+		void UpdateOverviewPack();
+		void DrawOverview(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext);
+
+		void OnToggleOverview();
+		void OnCycleCulling();
+		void OnNextPage();
+		void OnPreviousPage();
+
+		void StartTracking(UGameplayTagManager* TagManager);
+		void StopTracking();
+		void TakeSnapshot();
+		void OnTagCountChanged(UGameplayTagManager* TagManager, FGameplayTag Tag, int32 OldCount, int32 NewCount);
 
 	private:
+		TArray<FTrackedTagManager, TInlineAllocator<3>> TrackedManagers;
 		TWeakObjectPtr<AActor> LastDebugActor = nullptr;
 
-		FRepData DataPack;
+		FRepRecordsData RecordsPack;
+		FRepSnapshotData SnapshotPack;
+
+		FGTM_WorldOverview WorldOverview;
+		FRepOverviewData OverviewPack;
 	};
 }
 #endif
@@ -0,0 +1,171 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Gameplay/Async/GTM_AsyncAction_WaitForTag.h"
+
+#include "Gameplay/Misc/GameplayTagManager.h"
+#include "Gameplay/Misc/GTM_GameplayTagManagerSubsystem.h"
+#include "GameplayTagManagerModule.h"
+
+using namespace GameplayTagManager;
+
+UGTM_AsyncAction_WaitForTag* UGTM_AsyncAction_WaitForTag::WaitTagAdded(UGameplayTagManager* Manager,
+	FGameplayTag Tag)
+{
+	return Acquire(Manager, FTagWaitCondition::TagAdded(Tag));
+}
+
+UGTM_AsyncAction_WaitForTag* UGTM_AsyncAction_WaitForTag::WaitTagRemoved(UGameplayTagManager* Manager,
+	FGameplayTag Tag)
+{
+	return Acquire(Manager, FTagWaitCondition::TagRemoved(Tag));
+}
+
+UGTM_AsyncAction_WaitForTag* UGTM_AsyncAction_WaitForTag::WaitTagCountAtLeast(UGameplayTagManager* Manager,
+	FGameplayTag Tag, int32 Count)
+{
+	return Acquire(Manager, FTagWaitCondition::TagCountAtLeast(Tag, Count));
+}
+
+UGTM_AsyncAction_WaitForTag* UGTM_AsyncAction_WaitForTag::WaitQueryMatch(UGameplayTagManager* Manager,
+	FGameplayTagQuery Query)
+{
+	return Acquire(Manager, FTagWaitCondition::QueryMatch(Query));
+}
+
+void UGTM_AsyncAction_WaitForTag::Activate()
+{
+	Super::Activate();
+
+	UGameplayTagManager* Manager = WaitedManager.Get();
+	if (!IsValid(Manager))
+	{
+		LOGV(.Category(LogGameplayTagManager).Warn(), "UGTM_AsyncAction_WaitForTag activated with an invalid "
+			"manager.");
+		Fail();
+		return;
+	}
+
+	bIsActive = true;
+	if (Condition.IsMet(*Manager))
+	{
+		Trigger();
+		return;
+	}
+
+	Binding.Bind(*Manager, Condition.Type, Condition.Tag, [WeakThis = TWeakObjectPtr<ThisClass>(this)]
+	{
+		if (ThisClass* This = WeakThis.Get())
+		{
+			This->OnManagerChanged();
+		}
+	});
+}
+
+FGTM_TagWaitHandle UGTM_AsyncAction_WaitForTag::GetHandle() const
+{
+	FGTM_TagWaitHandle Handle;
+	Handle.Action = const_cast<ThisClass*>(this);
+	Handle.Serial = Serial;
+	return Handle;
+}
+
+bool UGTM_AsyncAction_WaitForTag::CancelWait(const FGTM_TagWaitHandle& Handle)
+{
+	ThisClass* Action = Handle.Action.Get();
+	if (!Action || Action->Serial != Handle.Serial || !Action->bIsActive)
+	{
+		return false;
+	}
+
+	Action->Release();
+	return true;
+}
+
+UGTM_AsyncAction_WaitForTag* UGTM_AsyncAction_WaitForTag::Acquire(UGameplayTagManager* Manager,
+	const FTagWaitCondition& InCondition)
+{
+	auto* Subsystem = IsValid(Manager) ? UGTM_GameplayTagManagerSubsystem::Get(Manager) : nullptr;
+
+	ThisClass* Action = Subsystem ? Subsystem->PopPooledWaitAction() : nullptr;
+	if (!Action)
+	{
+		Action = NewObject<ThisClass>(Subsystem ? static_cast<UObject*>(Subsystem) : GetTransientPackage());
+	}
+
+	Action->Condition = InCondition;
+	Action->WaitedManager = Manager;
+	Action->RegisterWithGameInstance(Manager);
+	return Action;
+}
+
+void UGTM_AsyncAction_WaitForTag::OnManagerChanged()
+{
+	const UGameplayTagManager* Manager = WaitedManager.Get();
+	if (bIsActive && Manager && Condition.IsMet(*Manager))
+	{
+		Trigger();
+	}
+}
+
+void UGTM_AsyncAction_WaitForTag::Trigger()
+{
+	UGameplayTagManager* Manager = WaitedManager.Get();
+
+	// The wait is over before anything bound runs, so cancelling it from there does nothing. The action goes back to
+	// the pool afterwards, unless it got reused in the meantime
+	EndWait();
+	const uint32 EndedSerial = Serial;
+
+	OnConditionMet.Broadcast(Manager);
+
+	if (Serial == EndedSerial)
+	{
+		ReturnToPool();
+	}
+}
+
+void UGTM_AsyncAction_WaitForTag::Fail()
+{
+	EndWait();
+	const uint32 EndedSerial = Serial;
+
+	// Lets Blueprint flows move on rather than waiting forever
+	OnFailed.Broadcast(nullptr);
+
+	if (Serial == EndedSerial)
+	{
+		ReturnToPool();
+	}
+}
+
+void UGTM_AsyncAction_WaitForTag::Release()
+{
+	EndWait();
+	ReturnToPool();
+}
+
+void UGTM_AsyncAction_WaitForTag::EndWait()
+{
+	Binding.Unbind();
+	bIsActive = false;
+
+	// Serial 0 is skipped so that default handles never match
+	Serial = Serial == MAX_uint32 ? 1 : Serial + 1;
+}
+
+void UGTM_AsyncAction_WaitForTag::ReturnToPool()
+{
+	OnConditionMet.Clear();
+	OnFailed.Clear();
+
+	auto* Subsystem = Cast<UGTM_GameplayTagManagerSubsystem>(GetOuter());
+
+	Condition = FTagWaitCondition();
+	WaitedManager = nullptr;
+	SetReadyToDestroy();
+
+	if (Subsystem)
+	{
+		Subsystem->PushPooledWaitAction(this);
+	}
+}
@@ -0,0 +1,192 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Gameplay/Async/GTM_TagWait.h"
+
+#include "Gameplay/Misc/GameplayTagManager.h"
+
+namespace
+{
+	using namespace GameplayTagManager;
+
+	/** Owned by the manager's listener, so it goes away along with the manager if the condition is never met. */
+	struct FFutureWaitState
+	{
+	public:
+		~FFutureWaitState()
+		{
+			SetValue(false);
+		}
+
+		void SetValue(bool bValue)
+		{
+			if (!bIsSet)
+			{
+				bIsSet = true;
+				Promise.SetValue(bValue);
+			}
+		}
+
+	public:
+		TPromise<bool> Promise;
+		FTagWaitBinding Binding;
+		FTagWaitCondition Condition;
+		TWeakObjectPtr<UGameplayTagManager> Manager;
+		bool bIsSet = false;
+	};
+}
+
+namespace GameplayTagManager
+{
+	FTagWaitCondition FTagWaitCondition::TagAdded(FGameplayTag Tag)
+	{
+		FTagWaitCondition Condition;
+		Condition.Type = EGTM_TagWaitType::Added;
+		Condition.Tag = Tag;
+		return Condition;
+	}
+
+	FTagWaitCondition FTagWaitCondition::TagRemoved(FGameplayTag Tag)
+	{
+		FTagWaitCondition Condition;
+		Condition.Type = EGTM_TagWaitType::Removed;
+		Condition.Tag = Tag;
+		return Condition;
+	}
+
+	FTagWaitCondition FTagWaitCondition::TagCountAtLeast(FGameplayTag Tag, int32 Count)
+	{
+		FTagWaitCondition Condition;
+		Condition.Type = EGTM_TagWaitType::CountAtLeast;
+		Condition.Tag = Tag;
+		Condition.Count = Count;
+		return Condition;
+	}
+
+	FTagWaitCondition FTagWaitCondition::QueryMatch(const FGameplayTagQuery& Query)
+	{
+		FTagWaitCondition Condition;
+		Condition.Type = EGTM_TagWaitType::QueryMatch;
+		Condition.Query = Query;
+		return Condition;
+	}
+
+	bool FTagWaitCondition::IsMet(const UGameplayTagManager& Manager) const
+	{
+		switch (Type)
+		{
+			case EGTM_TagWaitType::Added:
+				return Manager.GetTagCount(Tag) > 0;
+			case EGTM_TagWaitType::Removed:
+				return Manager.GetTagCount(Tag) == 0;
+			case EGTM_TagWaitType::CountAtLeast:
+				return Manager.GetTagCount(Tag) >= Count;
+			case EGTM_TagWaitType::QueryMatch:
+				return Query.Matches(Manager.GetTags());
+		}
+
+		return false;
+	}
+
+	FTagWaitBinding::~FTagWaitBinding()
+	{
+		Unbind();
+	}
+
+	void FTagWaitBinding::Bind(UGameplayTagManager& InManager, EGTM_TagWaitType InType, FGameplayTag Tag,
+		TFunction<void()> Callback)
+	{
+		Unbind();
+
+		Manager = &InManager;
+		Type = InType;
+
+		// Unbinding destroys the lambda, so the callback is invoked from a copy that outlives it
+		switch (Type)
+		{
+			case EGTM_TagWaitType::Added:
+			case EGTM_TagWaitType::Removed:
+				DelegateHandle = InManager.BindGameplayTagListener(
+					UGameplayTagManager::FOnTagChangedSimpleSignature::CreateLambda(
+						[Callback = MoveTemp(Callback)](UGameplayTagManager*, FGameplayTag, bool)
+						{
+							const TFunction<void()> CallbackCopy = Callback;
+							CallbackCopy();
+						}), Tag);
+				break;
+			case EGTM_TagWaitType::CountAtLeast:
+				DelegateHandle = InManager.BindTagCountListener(
+					UGameplayTagManager::FOnTagCountChangedSimpleSignature::FDelegate::CreateLambda(
+						[Callback = MoveTemp(Callback)](UGameplayTagManager*, FGameplayTag, int32, int32)
+						{
+							const TFunction<void()> CallbackCopy = Callback;
+							CallbackCopy();
+						}), Tag);
+				break;
+			case EGTM_TagWaitType::QueryMatch:
+				DelegateHandle = InManager.OnTagsChangeSimpleDelegate.AddLambda(
+					[Callback = MoveTemp(Callback)](UGameplayTagManager*, FGameplayTagContainer, FGameplayTagContainer)
+					{
+						const TFunction<void()> CallbackCopy = Callback;
+						CallbackCopy();
+					});
+				break;
+		}
+	}
+
+	void FTagWaitBinding::Unbind()
+	{
+		UGameplayTagManager* BoundManager = Manager.Get();
+		if (BoundManager && DelegateHandle.IsValid())
+		{
+			switch (Type)
+			{
+				case EGTM_TagWaitType::Added:
+				case EGTM_TagWaitType::Removed:
+					BoundManager->UnbindGameplayTagListener(DelegateHandle);
+					break;
+				case EGTM_TagWaitType::CountAtLeast:
+					BoundManager->UnbindTagCountListener(DelegateHandle);
+					break;
+				case EGTM_TagWaitType::QueryMatch:
+					BoundManager->OnTagsChangeSimpleDelegate.Remove(DelegateHandle);
+					break;
+			}
+		}
+
+		Manager = nullptr;
+		DelegateHandle.Reset();
+	}
+
+	TFuture<bool> WaitForTag(UGameplayTagManager* Manager, const FTagWaitCondition& Condition)
+	{
+		check(IsInGameThread());
+
+		if (!IsValid(Manager))
+		{
+			return MakeFulfilledPromise<bool>(false).GetFuture();
+		}
+
+		if (Condition.IsMet(*Manager))
+		{
+			return MakeFulfilledPromise<bool>(true).GetFuture();
+		}
+
+		const TSharedRef<FFutureWaitState> State = MakeShared<FFutureWaitState>();
+		State->Condition = Condition;
+		State->Manager = Manager;
+
+		TFuture<bool> Future = State->Promise.GetFuture();
+		State->Binding.Bind(*Manager, Condition.Type, Condition.Tag, [State]
+		{
+			const UGameplayTagManager* BoundManager = State->Manager.Get();
+			if (BoundManager && State->Condition.IsMet(*BoundManager))
+			{
+				// Releases the listener's reference; the caller's copy of the callback keeps the state alive
+				State->Binding.Unbind();
+				State->SetValue(true);
+			}
+		});
+
+		return Future;
+	}
+}
@@ -0,0 +1,81 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Gameplay/Misc/GTM_GameplayTagAnimInstance.h"
+
+#include "Gameplay/Misc/GameplayTagManager.h"
+
+namespace
+{
+	// Bounds of the delay between attempts to find a manager that didn't exist yet
+	constexpr float MinInitializeRetryInterval = 0.1f;
+	constexpr float MaxInitializeRetryInterval = 2.f;
+}
+
+UGTM_GameplayTagAnimInstance::UGTM_GameplayTagAnimInstance()
+{
+	GameplayTagPropertyMap.SetDeferred(true);
+}
+
+int32 UGTM_GameplayTagAnimInstance::GetMappedTagCount(FGameplayTag Tag) const
+{
+	return GameplayTagPropertyMap.GetAppliedCount(Tag);
+}
+
+bool UGTM_GameplayTagAnimInstance::HasMappedTag(FGameplayTag Tag) const
+{
+	return GameplayTagPropertyMap.GetAppliedCount(Tag) > 0;
+}
+
+void UGTM_GameplayTagAnimInstance::NativeInitializeAnimation()
+{
+	Super::NativeInitializeAnimation();
+
+	TryInitializePropertyMap();
+}
+
+void UGTM_GameplayTagAnimInstance::PreUpdateAnimation(float DeltaSeconds)
+{
+	Super::PreUpdateAnimation(DeltaSeconds);
+
+	// The manager may have not existed when the animation was initialized. Finding it walks the owner's components,
+	// so the attempts get further apart for as long as it's missing
+	if (!GameplayTagPropertyMap.IsInitialized())
+	{
+		InitializeRetryTimeLeft -= DeltaSeconds;
+		if (InitializeRetryTimeLeft <= 0.f)
+		{
+			TryInitializePropertyMap();
+		}
+	}
+
+	// The worker thread update runs after this, so it's the last point where writing the properties is safe
+	GameplayTagPropertyMap.ApplyDeferredValues();
+}
+
+void UGTM_GameplayTagAnimInstance::NativeUninitializeAnimation()
+{
+	GameplayTagPropertyMap.Unregister();
+
+	Super::NativeUninitializeAnimation();
+}
+
+UGameplayTagManager* UGTM_GameplayTagAnimInstance::FindGameplayTagManager() const
+{
+	// Previews may run without an owning actor
+	const AActor* OwningActor = GetOwningActor();
+	return IsValid(OwningActor) ? UGameplayTagManager::Get(OwningActor) : nullptr;
+}
+
+void UGTM_GameplayTagAnimInstance::TryInitializePropertyMap()
+{
+	if (UGameplayTagManager* GameplayTagManager = FindGameplayTagManager())
+	{
+		GameplayTagPropertyMap.Initialize(this, GameplayTagManager);
+		InitializeRetryInterval = 0.f;
+		return;
+	}
+
+	InitializeRetryInterval = FMath::Clamp(InitializeRetryInterval * 2.f, MinInitializeRetryInterval,
+		MaxInitializeRetryInterval);
+	InitializeRetryTimeLeft = InitializeRetryInterval;
+}
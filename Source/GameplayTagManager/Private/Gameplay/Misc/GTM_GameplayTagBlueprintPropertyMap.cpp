@@ -6,14 +6,180 @@
 #include "GameplayTagManagerModule.h"
 #include "Misc/DataValidation.h"
 
-FGTM_GameplayTagBlueprintPropertyMapping::FGTM_GameplayTagBlueprintPropertyMapping(
-	const FGTM_GameplayTagBlueprintPropertyMapping& Other)
-	: TagToMap(Other.TagToMap)
-	, PropertyToEdit(Other.PropertyToEdit)
-	, PropertyName(Other.PropertyName)
-	, PropertyGuid(Other.PropertyGuid)
-	, DelegateHandle() // Don't copy handle
+struct FGTM_GameplayTagBlueprintPropertyMap::FBindingLayout
 {
+public:
+	enum class EPropertyType : uint8
+	{
+		Bool,
+		Int,
+		Float,
+		Double,
+	};
+
+	/** Writes straight to the owner's memory, without going through the reflected property. */
+	struct FPropertyBinding
+	{
+	public:
+		void Apply(UObject* Owner, int32 Count) const;
+
+	public:
+		int32 Offset = 0;
+		EPropertyType Type = EPropertyType::Bool;
+
+		/** Bitfield masks of booleans. */
+		uint8 FieldMask = 0;
+		uint8 ByteMask = 0;
+	};
+
+	struct FTagLayout
+	{
+	public:
+		TArray<FPropertyBinding, TInlineAllocator<1>> Properties;
+		bool bHasCountMappings = false;
+	};
+
+	/** Mapped tag pointing at its range of FlatBindings. */
+	struct FFlatTag
+	{
+	public:
+		FGameplayTag Tag;
+		int32 FirstBinding = 0;
+		int32 NumBindings = 0;
+	};
+
+public:
+	static TSharedRef<const FBindingLayout> FindOrCreate(const UClass* Class,
+		TConstArrayView<FGTM_GameplayTagBlueprintPropertyMapping> Mappings);
+
+	bool Matches(TConstArrayView<FGTM_GameplayTagBlueprintPropertyMapping> Mappings) const;
+
+public:
+	TMap<FGameplayTag, FTagLayout> Tags;
+
+	/** Same bindings as Tags, flattened for the full syncs. */
+	TArray<FFlatTag> FlatTags;
+	TArray<FPropertyBinding> FlatBindings;
+
+	/** Tag and property name pairs the layout was resolved from. */
+	TArray<TPair<FGameplayTag, FName>> MappingSet;
+};
+
+void FGTM_GameplayTagBlueprintPropertyMap::FBindingLayout::FPropertyBinding::Apply(UObject* Owner, int32 Count) const
+{
+	uint8* Memory = reinterpret_cast<uint8*>(Owner) + Offset;
+	switch (Type)
+	{
+		case EPropertyType::Bool:
+			*Memory = (*Memory & ~FieldMask) | (Count > 0 ? ByteMask : 0);
+			break;
+		case EPropertyType::Int:
+			*reinterpret_cast<int32*>(Memory) = Count;
+			break;
+		case EPropertyType::Float:
+			*reinterpret_cast<float*>(Memory) = static_cast<float>(Count);
+			break;
+		case EPropertyType::Double:
+			*reinterpret_cast<double*>(Memory) = static_cast<double>(Count);
+			break;
+	}
+}
+
+TSharedRef<const FGTM_GameplayTagBlueprintPropertyMap::FBindingLayout>
+	FGTM_GameplayTagBlueprintPropertyMap::FBindingLayout::FindOrCreate(const UClass* Class,
+		TConstArrayView<FGTM_GameplayTagBlueprintPropertyMapping> Mappings)
+{
+	check(IsInGameThread());
+
+	// Recompiled blueprint classes are new objects, so stale layouts are never matched
+	static TMap<TObjectKey<UClass>, TArray<TSharedRef<const FBindingLayout>, TInlineAllocator<1>>> Cache;
+
+	auto& ClassLayouts = Cache.FindOrAdd(Class);
+	for (const TSharedRef<const FBindingLayout>& ClassLayout : ClassLayouts)
+	{
+		if (ClassLayout->Matches(Mappings))
+		{
+			return ClassLayout;
+		}
+	}
+
+	const TSharedRef<FBindingLayout> NewLayout = MakeShared<FBindingLayout>();
+	for (int32 MappingIndex = 0; MappingIndex < Mappings.Num(); ++MappingIndex)
+	{
+		const FGTM_GameplayTagBlueprintPropertyMapping& Mapping = Mappings[MappingIndex];
+		NewLayout->MappingSet.Emplace(Mapping.TagToMap, Mapping.PropertyName);
+
+		const FProperty* Property = Mapping.TagToMap.IsValid()
+			? Class->FindPropertyByName(Mapping.PropertyName)
+			: nullptr;
+
+		FPropertyBinding Binding;
+		if (const auto* BoolProperty = CastField<const FBoolProperty>(Property))
+		{
+			Binding.Type = EPropertyType::Bool;
+			Binding.Offset = BoolProperty->GetOffset_ForInternal() + BoolProperty->GetByteOffset();
+			Binding.FieldMask = BoolProperty->GetFieldMask();
+			Binding.ByteMask = BoolProperty->GetByteMask();
+		}
+		else if (CastField<const FIntProperty>(Property))
+		{
+			Binding.Type = EPropertyType::Int;
+			Binding.Offset = Property->GetOffset_ForInternal();
+		}
+		else if (CastField<const FFloatProperty>(Property))
+		{
+			Binding.Type = EPropertyType::Float;
+			Binding.Offset = Property->GetOffset_ForInternal();
+		}
+		else if (CastField<const FDoubleProperty>(Property))
+		{
+			Binding.Type = EPropertyType::Double;
+			Binding.Offset = Property->GetOffset_ForInternal();
+		}
+		else
+		{
+			// Logged once per class rather than once per instance
+			LOGV(.Category(LogGameplayTagManager).Error(), "FGTM_GameplayTagBlueprintPropertyMap: "
+				"Ignoring invalid GameplayTagBlueprintPropertyMapping [Index: {0}, Tag:{1}, Property:{2}] for [{3}].",
+				MappingIndex, Mapping.TagToMap, Mapping.PropertyName, Class->GetName());
+			continue;
+		}
+
+		FTagLayout& TagLayout = NewLayout->Tags.FindOrAdd(Mapping.TagToMap);
+		TagLayout.Properties.Add(Binding);
+
+		TagLayout.bHasCountMappings |= Binding.Type != EPropertyType::Bool;
+	}
+
+	NewLayout->FlatTags.Reserve(NewLayout->Tags.Num());
+	for (const auto& [Tag, TagLayout] : NewLayout->Tags)
+	{
+		NewLayout->FlatTags.Add({ Tag, NewLayout->FlatBindings.Num(), TagLayout.Properties.Num() });
+		NewLayout->FlatBindings.Append(TagLayout.Properties);
+	}
+
+	ClassLayouts.Add(NewLayout);
+	return NewLayout;
+}
+
+bool FGTM_GameplayTagBlueprintPropertyMap::FBindingLayout::Matches(
+	TConstArrayView<FGTM_GameplayTagBlueprintPropertyMapping> Mappings) const
+{
+	if (MappingSet.Num() != Mappings.Num())
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < Mappings.Num(); ++Index)
+	{
+		const auto& [Tag, PropertyName] = MappingSet[Index];
+		if (Tag != Mappings[Index].TagToMap || PropertyName != Mappings[Index].PropertyName)
+		{
+			return false;
+		}
+	}
+
+	return true;
 }
 
 FGTM_GameplayTagBlueprintPropertyMap::FGTM_GameplayTagBlueprintPropertyMap(
@@ -23,6 +189,7 @@ FGTM_GameplayTagBlueprintPropertyMap::FGTM_GameplayTagBlueprintPropertyMap(
 		TEXT("FGTM_GameplayTagBlueprintPropertyMap cannot be used inside an array or other container "
 			"that is copied after register!"));
 	PropertyMappings = Other.PropertyMappings;
+	bDeferred = Other.bDeferred;
 }
 
 FGTM_GameplayTagBlueprintPropertyMap::~FGTM_GameplayTagBlueprintPropertyMap()
@@ -61,41 +228,31 @@ void FGTM_GameplayTagBlueprintPropertyMap::Initialize(UObject* InOwner, UGamepla
 	CachedOwner = InOwner;
 	CachedGameplayTagManager = InGameplayTagManager;
 
+	// Every instance of a class shares the resolved properties; only the first one pays for finding them
+	Layout = FBindingLayout::FindOrCreate(OwnerClass, PropertyMappings);
+
 	UGameplayTagManager::FOnTagChangedSimpleSignature Delegate;
 	Delegate.BindRaw(this, &ThisClass::GameplayTagEventCallback);
 
-	// Process array starting at the end so we can remove invalid entries
-	for (int32 MappingIndex = (PropertyMappings.Num() - 1); MappingIndex >= 0; --MappingIndex)
-	{
-		FGTM_GameplayTagBlueprintPropertyMapping& Mapping = PropertyMappings[MappingIndex];
+	UGameplayTagManager::FOnTagCountChangedSimpleSignature::FDelegate CountDelegate;
+	CountDelegate.BindRaw(this, &ThisClass::GameplayTagCountCallback);
 
-		if (Mapping.TagToMap.IsValid())
+	for (const auto& [Tag, TagLayout] : Layout->Tags)
+	{
+		// All mappings of a tag share a single listener; booleans only care about presence, the rest about counts
+		if (TagLayout.bHasCountMappings)
 		{
-			FProperty* Property = OwnerClass->FindPropertyByName(Mapping.PropertyName);
-			if (Property && IsPropertyTypeValid(Property))
-			{
-				Mapping.PropertyToEdit = Property;
-				Mapping.DelegateHandle = CachedGameplayTagManager->BindGameplayTagListener(
-					Delegate, Mapping.TagToMap);
-				continue;
-			}
+			CountDelegateHandles.Add(CachedGameplayTagManager->BindTagCountListener(CountDelegate, Tag));
+		}
+		else
+		{
+			DelegateHandles.Add(CachedGameplayTagManager->BindGameplayTagListener(Delegate, Tag));
 		}
-
-		// Entry was invalid: Remove it from the array
-		LOGV(.Category(LogGameplayTagManager).Error(), "FGTM_GameplayTagBlueprintPropertyMap: "
-			"Removing invalid GameplayTagBlueprintPropertyMapping [Index: {0}, Tag:{1}, Property:{2}] for [{3}].",
-			MappingIndex, Mapping.TagToMap, Mapping.PropertyName, InOwner->GetName());
-
-		PropertyMappings.RemoveAtSwap(MappingIndex, EAllowShrinking::No);
 	}
 
-	// Broadcast all bindings to make sure that our state is correct in case some of the tags were already present
-	// before initializating the property map
-	for (const FGTM_GameplayTagBlueprintPropertyMapping& PropertyMapping : PropertyMappings)
-	{
-		Delegate.Execute(CachedGameplayTagManager.Get(), PropertyMapping.TagToMap,
-			CachedGameplayTagManager->HasTag(PropertyMapping.TagToMap, true));
-	}
+	// Make sure that our state is correct in case some of the tags were already present before initializing the
+	// property map. Nothing reads the properties on other threads yet, so deferred maps can write right away.
+	SyncAllTags(/*bWriteNow=*/true);
 }
 
 void FGTM_GameplayTagBlueprintPropertyMap::ApplyCurrentTags()
@@ -116,17 +273,41 @@ void FGTM_GameplayTagBlueprintPropertyMap::ApplyCurrentTags()
 		return;
 	}
 
-	for (FGTM_GameplayTagBlueprintPropertyMapping& Mapping : PropertyMappings)
+	if (!Layout.IsValid())
 	{
-		if (Mapping.PropertyToEdit.Get() && Mapping.TagToMap.IsValid())
-		{
-			if (const FBoolProperty* BoolProperty = CastField<const FBoolProperty>(Mapping.PropertyToEdit.Get()))
-			{
-				const bool bHasTag = GameplayTagManager->HasTag(Mapping.TagToMap);
-				BoolProperty->SetPropertyValue_InContainer(Owner, bHasTag);
-			}
-		}
+		return;
+	}
+
+	SyncAllTags(/*bWriteNow=*/false);
+}
+
+void FGTM_GameplayTagBlueprintPropertyMap::SetDeferred(bool bInDeferred)
+{
+	ensureMsgf(!IsInitialized(), TEXT("FGTM_GameplayTagBlueprintPropertyMap: SetDeferred() called after "
+		"Initialize()."));
+	bDeferred = bInDeferred;
+}
+
+void FGTM_GameplayTagBlueprintPropertyMap::ApplyDeferredValues()
+{
+	for (const auto& [Tag, Count] : PendingCounts)
+	{
+		WriteTag(Tag, Count);
+		AppliedCounts.Add(Tag, Count);
 	}
+
+	PendingCounts.Reset();
+}
+
+int32 FGTM_GameplayTagBlueprintPropertyMap::GetAppliedCount(FGameplayTag Tag) const
+{
+	const int32* Count = AppliedCounts.Find(Tag);
+	return Count ? *Count : 0;
+}
+
+bool FGTM_GameplayTagBlueprintPropertyMap::IsInitialized() const
+{
+	return Layout.IsValid();
 }
 
 #if WITH_EDITOR
@@ -156,7 +337,7 @@ EDataValidationResult FGTM_GameplayTagBlueprintPropertyMap::IsDataValid(const UO
 			{
 				Context.AddError(FText::Format(INVTEXT(
 						"The property [{0}] for gameplay tag [{1}] is not a supported type.  "
-						"Supported types are: boolean."),
+						"Supported types are: boolean, integer and float."),
 					FText::FromName(Mapping.PropertyName),
 					FText::AsCultureInvariant(Mapping.TagToMap.ToString())));
 			}
@@ -177,13 +358,22 @@ void FGTM_GameplayTagBlueprintPropertyMap::Unregister()
 {
 	if (CachedGameplayTagManager.IsValid())
 	{
-		for (FGTM_GameplayTagBlueprintPropertyMapping& PropertyMapping : PropertyMappings)
+		for (const FDelegateHandle& DelegateHandle : DelegateHandles)
+		{
+			CachedGameplayTagManager->UnbindGameplayTagListener(DelegateHandle);
+		}
+
+		for (const FDelegateHandle& DelegateHandle : CountDelegateHandles)
 		{
-			CachedGameplayTagManager->UnbindGameplayTagListener(PropertyMapping.DelegateHandle);
-			PropertyMapping.PropertyToEdit = nullptr;
+			CachedGameplayTagManager->UnbindTagCountListener(DelegateHandle);
 		}
 	}
 
+	Layout.Reset();
+	PendingCounts.Reset();
+	AppliedCounts.Reset();
+	DelegateHandles.Reset();
+	CountDelegateHandles.Reset();
 	CachedOwner = nullptr;
 	CachedGameplayTagManager = nullptr;
 }
@@ -191,23 +381,86 @@ void FGTM_GameplayTagBlueprintPropertyMap::Unregister()
 bool FGTM_GameplayTagBlueprintPropertyMap::IsPropertyTypeValid(const FProperty* Property) const
 {
 	check(Property);
-	return Property->IsA<FBoolProperty>();
+	return Property->IsA<FBoolProperty>() || Property->IsA<FIntProperty>() || Property->IsA<FFloatProperty>() ||
+		Property->IsA<FDoubleProperty>();
 }
 
 void FGTM_GameplayTagBlueprintPropertyMap::GameplayTagEventCallback(UGameplayTagManager* Manager, FGameplayTag Tag,
 	bool bIsPresent)
 {
-	FGTM_GameplayTagBlueprintPropertyMapping* Mapping = PropertyMappings.FindByPredicate(
-		[Tag](const FGTM_GameplayTagBlueprintPropertyMapping& Test)
+	ApplyTag(Tag, bIsPresent ? Manager->GetTagCount(Tag) : 0);
+}
+
+void FGTM_GameplayTagBlueprintPropertyMap::GameplayTagCountCallback(UGameplayTagManager* Manager, FGameplayTag Tag,
+	int32 OldCount, int32 NewCount)
+{
+	ApplyTag(Tag, NewCount);
+}
+
+void FGTM_GameplayTagBlueprintPropertyMap::ApplyTag(FGameplayTag Tag, int32 Count)
+{
+	if (bDeferred)
+	{
+		// Listeners are also called for child tags, which aren't mapped
+		if (Layout.IsValid() && Layout->Tags.Contains(Tag))
 		{
-			return (Tag == Test.TagToMap);
-		});
+			PendingCounts.Add(Tag, Count);
+		}
+
+		return;
+	}
+
+	WriteTag(Tag, Count);
+}
 
-	if (Mapping && Mapping->PropertyToEdit.Get())
+void FGTM_GameplayTagBlueprintPropertyMap::SyncAllTags(bool bWriteNow)
+{
+	UObject* Owner = CachedOwner.Get();
+	const UGameplayTagManager* GameplayTagManager = CachedGameplayTagManager.Get();
+	if (!Layout.IsValid() || !Owner || !GameplayTagManager)
+	{
+		return;
+	}
+
+	const TMap<FGameplayTag, int32>& TagsToCount = GameplayTagManager->GetTagsToCount();
+
+	// One lookup per mapped tag; absent ones are 0
+	const bool bStage = bDeferred && !bWriteNow;
+	for (const FBindingLayout::FFlatTag& FlatTag : Layout->FlatTags)
 	{
-		if (const FBoolProperty* BoolProperty = CastField<const FBoolProperty>(Mapping->PropertyToEdit.Get()))
+		const int32 Count = TagsToCount.FindRef(FlatTag.Tag);
+
+		if (bStage)
 		{
-			BoolProperty->SetPropertyValue_InContainer(CachedOwner.Get(), bIsPresent);
+			PendingCounts.Add(FlatTag.Tag, Count);
+			continue;
 		}
+
+		for (int32 Index = 0; Index < FlatTag.NumBindings; ++Index)
+		{
+			Layout->FlatBindings[FlatTag.FirstBinding + Index].Apply(Owner, Count);
+		}
+
+		if (bDeferred)
+		{
+			PendingCounts.Remove(FlatTag.Tag);
+			AppliedCounts.Add(FlatTag.Tag, Count);
+		}
+	}
+}
+
+void FGTM_GameplayTagBlueprintPropertyMap::WriteTag(FGameplayTag Tag, int32 Count)
+{
+	// Listeners are also called for child tags, which aren't mapped
+	const FBindingLayout::FTagLayout* TagLayout = Layout.IsValid() ? Layout->Tags.Find(Tag) : nullptr;
+	UObject* Owner = CachedOwner.Get();
+	if (!TagLayout || !Owner)
+	{
+		return;
+	}
+
+	for (const FBindingLayout::FPropertyBinding& Binding : TagLayout->Properties)
+	{
+		Binding.Apply(Owner, Count);
 	}
 }
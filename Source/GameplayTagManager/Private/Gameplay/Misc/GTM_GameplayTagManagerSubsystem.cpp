@@ -0,0 +1,131 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Gameplay/Misc/GTM_GameplayTagManagerSubsystem.h"
+
+#include "Async/ParallelFor.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Gameplay/Async/GTM_AsyncAction_WaitForTag.h"
+#include "Gameplay/Misc/GameplayTagManager.h"
+#include "Profiling/GTM_Profiling.h"
+
+namespace
+{
+	/** Below this amount of managers the overhead of dispatching work to other threads isn't worth it. */
+	int32 GMinManagersForParallelBulkOperations = 64;
+	FAutoConsoleVariableRef CVarMinManagersForParallelBulkOperations(
+		TEXT("gtm.Bulk.MinParallelManagers"),
+		GMinManagersForParallelBulkOperations,
+		TEXT("Minimum amount of managers allowing parallel mutation a bulk operation needs to use worker threads."));
+
+	int32 GMaxPooledWaitActions = 256;
+	FAutoConsoleVariableRef CVarMaxPooledWaitActions(
+		TEXT("gtm.WaitForTag.MaxPooledActions"),
+		GMaxPooledWaitActions,
+		TEXT("Maximum amount of finished wait for tag actions kept per world for reuse. Extra ones are left to GC."));
+}
+
+UGTM_GameplayTagManagerSubsystem* UGTM_GameplayTagManagerSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	return World ? World->GetSubsystem<ThisClass>() : nullptr;
+}
+
+void UGTM_GameplayTagManagerSubsystem::ApplyBulkTagOperations(const TArray<UGameplayTagManager*>& Managers,
+	const TArray<FGTM_TagOperation>& Operations, bool bAllowParallel)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GTM_BulkOperations);
+
+	if (Operations.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<UGameplayTagManager*> ParallelManagers;
+	for (UGameplayTagManager* Manager : Managers)
+	{
+		if (!IsValid(Manager))
+		{
+			continue;
+		}
+
+		if (bAllowParallel && Manager->AllowsParallelBulkMutation())
+		{
+			ParallelManagers.Add(Manager);
+		}
+		else
+		{
+			Manager->ApplyTagOperations(Operations);
+		}
+	}
+
+	if (ParallelManagers.IsEmpty())
+	{
+		return;
+	}
+
+	const EParallelForFlags Flags = ParallelManagers.Num() < GMinManagersForParallelBulkOperations
+		? EParallelForFlags::ForceSingleThread
+		: EParallelForFlags::None;
+
+	ParallelFor(ParallelManagers.Num(), [&ParallelManagers, &Operations](int32 Index)
+	{
+		ParallelManagers[Index]->ApplyTagOperationsImpl(Operations);
+	}, Flags);
+
+	// Neither push model nor the listeners are thread safe; mark and notify on the game thread once all the work is
+	// done
+	for (UGameplayTagManager* Manager : ParallelManagers)
+	{
+		Manager->FlushPendingChanges();
+	}
+}
+
+void UGTM_GameplayTagManagerSubsystem::RegisterManager(UGameplayTagManager* Manager)
+{
+	if (Manager->RegistryIndex != INDEX_NONE)
+	{
+		return;
+	}
+
+	Manager->RegistryIndex = RegisteredManagers.Add(Manager);
+}
+
+void UGTM_GameplayTagManagerSubsystem::UnregisterManager(UGameplayTagManager* Manager)
+{
+	// Managers remember their slot, so that tearing down a level doesn't search the registry for each of them
+	const int32 Index = Manager->RegistryIndex;
+	if (!RegisteredManagers.IsValidIndex(Index) || RegisteredManagers[Index] != Manager)
+	{
+		return;
+	}
+
+	Manager->RegistryIndex = INDEX_NONE;
+	RegisteredManagers.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	if (RegisteredManagers.IsValidIndex(Index))
+	{
+		if (UGameplayTagManager* MovedManager = RegisteredManagers[Index].Get())
+		{
+			MovedManager->RegistryIndex = Index;
+		}
+	}
+}
+
+const TArray<TWeakObjectPtr<UGameplayTagManager>>& UGTM_GameplayTagManagerSubsystem::GetRegisteredManagers() const
+{
+	return RegisteredManagers;
+}
+
+UGTM_AsyncAction_WaitForTag* UGTM_GameplayTagManagerSubsystem::PopPooledWaitAction()
+{
+	return PooledWaitActions.IsEmpty() ? nullptr : PooledWaitActions.Pop(EAllowShrinking::No).Get();
+}
+
+void UGTM_GameplayTagManagerSubsystem::PushPooledWaitAction(UGTM_AsyncAction_WaitForTag* Action)
+{
+	if (PooledWaitActions.Num() < GMaxPooledWaitActions)
+	{
+		PooledWaitActions.Add(Action);
+	}
+}
@@ -2,9 +2,12 @@
 
 #include "Gameplay/Misc/GTM_GameplayTagStackContainer.h"
 
-#include "GameplayTagManagerModule.h"
+#include "Debug/GTM_MutationLog.h"
 #include "Gameplay/Misc/GameplayTagManager.h"
 #include "Profiling/GTM_Profiling.h"
+#include "Profiling/GTM_TagChurn.h"
+#include "Profiling/GTM_TagJournal.h"
+#include "Profiling/GTM_Trace.h"
 
 FGTM_GameplayTagStack::FGTM_GameplayTagStack(const FGameplayTag& InTag, int32 InStackCount)
 	: Tag(InTag)
@@ -22,10 +25,62 @@ bool FGTM_GameplayTagStack::operator==(const FGTM_GameplayTagStack& Rhs) const
 	return Tag == Rhs.Tag;
 }
 
-FGTM_GameplayTagStackContainer::FGTM_GameplayTagStackContainer(UActorComponent* InOwner, const FString& InType)
+bool GameplayTagManager::FTagContribution::IsFree() const
+{
+	return StackCount == 0;
+}
+
+FGTM_GameplayTagStackContainer::FGTM_GameplayTagStackContainer(UActorComponent* InOwner,
+	EGTM_StackContainerId InContainerId)
 	: Owner(InOwner)
-	, Type(InType)
+	, ContainerId(InContainerId)
+{
+}
+
+FGTM_GameplayTagStackContainer::FGTM_GameplayTagStackContainer(UActorComponent* InOwner,
+	EGTM_StackContainerId InContainerId, GameplayTagManager::FLocalTagStackArray& InLocalStacks)
+	: LocalStacks(&InLocalStacks)
+	, Owner(InOwner)
+	, ContainerId(InContainerId)
+{
+}
+
+FGTM_GameplayTagStackContainer::FGTM_GameplayTagStackContainer(const FGTM_GameplayTagStackContainer& Other)
 {
+	*this = Other;
+}
+
+FGTM_GameplayTagStackContainer& FGTM_GameplayTagStackContainer::operator=(const FGTM_GameplayTagStackContainer& Other)
+{
+	if (this == &Other)
+	{
+		return *this;
+	}
+
+	FFastArraySerializer::operator=(Other);
+
+	// Each container keeps its own storage, only the stacks themselves are copied
+	VisitStacks([&Other](auto& OutStacks)
+	{
+		OutStacks.Reset();
+		Other.VisitStacks([&OutStacks](const auto& OtherStacks)
+		{
+			OutStacks.Append(OtherStacks);
+		});
+	});
+
+	TagToCountMap = Other.TagToCountMap;
+	Tags = Other.Tags;
+	ContributionArena = Other.ContributionArena
+		? MakeUnique<GameplayTagManager::FTagContributionArena>(*Other.ContributionArena)
+		: nullptr;
+	bHasChangedAnything = Other.bHasChangedAnything;
+	bCompactStorage = Other.bCompactStorage;
+	Owner = Other.Owner;
+	ContainerId = Other.ContainerId;
+	OnInternalsChangedDelegate = Other.OnInternalsChangedDelegate;
+	OnStackCountChangedDelegate = Other.OnStackCountChangedDelegate;
+	return *this;
 }
 
 void FGTM_GameplayTagStackContainer::AddStack(FGameplayTag Tag, int32 StackCount)
@@ -42,18 +97,11 @@ void FGTM_GameplayTagStackContainer::AddStack(FGameplayTag Tag, int32 StackCount
 
 	SCOPE_CYCLE_COUNTER(STAT_GTM_AddingTags);
 
-	if (Tags.HasTagExact(Tag))
+	if (FGTM_GameplayTagStack* Stack = FindStack(Tag))
 	{
 		// Add to existing stack
-		for (FGTM_GameplayTagStack& Stack : Stacks)
-		{
-			if (Stack.Tag == Tag)
-			{
-				const int32 NewCount = Stack.StackCount + StackCount;
-				SetExistingStackCountImpl(Stack, NewCount);
-				return;
-			}
-		}
+		const int32 NewCount = Stack->StackCount + StackCount;
+		SetExistingStackCountImpl(*Stack, NewCount);
 	}
 	else
 	{
@@ -74,33 +122,31 @@ void FGTM_GameplayTagStackContainer::RemoveStack(FGameplayTag Tag, int32 StackCo
 		return;
 	}
 
-	if (!Tags.HasTagExact(Tag))
-	{
-		return;
-	}
-
 	SCOPE_CYCLE_COUNTER(STAT_GTM_RemovingTags);
 
-	for (auto It = Stacks.CreateIterator(); It; ++It)
+	VisitStacks([this, Tag, StackCount](auto& InStacks)
 	{
-		FGTM_GameplayTagStack& Stack = *It;
-		if (Stack.Tag == Tag)
+		for (auto It = InStacks.CreateIterator(); It; ++It)
 		{
-			if (Stack.StackCount == StackCount)
-			{
-				FGTM_GameplayTagStack StackCopy = Stack;
-				It.RemoveCurrent();
-				RemoveStackImpl(StackCopy);
-			}
-			else
+			FGTM_GameplayTagStack& Stack = *It;
+			if (Stack.Tag == Tag)
 			{
-				const int32 NewCount = Stack.StackCount - StackCount;
-				SetExistingStackCountImpl(Stack, NewCount);
-			}
+				if (Stack.StackCount == StackCount)
+				{
+					FGTM_GameplayTagStack StackCopy = Stack;
+					It.RemoveCurrent();
+					RemoveStackImpl(StackCopy);
+				}
+				else
+				{
+					const int32 NewCount = Stack.StackCount - StackCount;
+					SetExistingStackCountImpl(Stack, NewCount);
+				}
 
-			return;
+				return;
+			}
 		}
-	}
+	});
 }
 
 void FGTM_GameplayTagStackContainer::OverrideStack(FGameplayTag Tag, int32 StackCount)
@@ -117,35 +163,37 @@ void FGTM_GameplayTagStackContainer::OverrideStack(FGameplayTag Tag, int32 Stack
 
 	SCOPE_CYCLE_COUNTER(STAT_GTM_OverridingTags);
 
-	const int32* FoundCount = TagToCountMap.Find(Tag);
-	if (FoundCount)
+	if (const FGTM_GameplayTagStack* FoundStack = FindStack(Tag))
 	{
-		if (*FoundCount == StackCount)
+		if (FoundStack->StackCount == StackCount)
 		{
 			// Avoid overriding with the same count
 			return;
 		}
 
 		// Override existing one
-		for (auto It = Stacks.CreateIterator(); It; ++It)
+		VisitStacks([this, Tag, StackCount](auto& InStacks)
 		{
-			FGTM_GameplayTagStack& Stack = *It;
-			if (Stack.Tag == Tag)
+			for (auto It = InStacks.CreateIterator(); It; ++It)
 			{
-				if (StackCount == 0)
+				FGTM_GameplayTagStack& Stack = *It;
+				if (Stack.Tag == Tag)
 				{
-					FGTM_GameplayTagStack StackCopy = Stack;
-					It.RemoveCurrent();
-					RemoveStackImpl(StackCopy);
+					if (StackCount == 0)
+					{
+						FGTM_GameplayTagStack StackCopy = Stack;
+						It.RemoveCurrent();
+						RemoveStackImpl(StackCopy);
+					}
+					else
+					{
+						SetExistingStackCountImpl(Stack, StackCount);
+					}
+
+					return;
 				}
-				else
-				{
-					SetExistingStackCountImpl(Stack, StackCount);
-				}
-
-				return;
 			}
-		}
+		});
 	}
 	else
 	{
@@ -162,33 +210,273 @@ void FGTM_GameplayTagStackContainer::OverrideStack(FGameplayTag Tag, int32 Stack
 
 int32 FGTM_GameplayTagStackContainer::GetStackCount(FGameplayTag Tag) const
 {
+	if (bCompactStorage)
+	{
+		const FGTM_GameplayTagStack* FoundStack = FindStack(Tag);
+		return FoundStack ? FoundStack->StackCount : 0;
+	}
+
 	return TagToCountMap.FindRef(Tag);
 }
 
 bool FGTM_GameplayTagStackContainer::ContainsTag(FGameplayTag Tag) const
 {
+	if (bCompactStorage)
+	{
+		return FindStack(Tag) != nullptr;
+	}
+
 	return TagToCountMap.Contains(Tag);
 }
 
+FGTM_TagContributionHandle FGTM_GameplayTagStackContainer::AddContribution(FGameplayTag Tag, int32 StackCount,
+	FObjectKey Source)
+{
+	if (!ensureMsgf(Tag.IsValid(), TEXT("An invalid tag was passed to AddContribution")))
+	{
+		return FGTM_TagContributionHandle();
+	}
+
+	if (!ensureMsgf(StackCount > 0, TEXT("An invalid count was passed to AddContribution")))
+	{
+		return FGTM_TagContributionHandle();
+	}
+
+	if (!ensureMsgf(Source != FObjectKey(), TEXT("An invalid source was passed to AddContribution")))
+	{
+		return FGTM_TagContributionHandle();
+	}
+
+	GameplayTagManager::FTagContributionArena& Arena = GetOrCreateContributionArena();
+
+	int32 Index = Arena.FirstFreeContribution;
+	if (Index != INDEX_NONE)
+	{
+		Arena.FirstFreeContribution = Arena.Contributions[Index].NextIndex;
+	}
+	else
+	{
+		Index = Arena.Contributions.AddDefaulted();
+	}
+
+	// Contributions of a source are pushed to the front of its list
+	int32& FirstSourceIndex = Arena.SourceToFirstContribution.FindOrAdd(Source, INDEX_NONE);
+
+	GameplayTagManager::FTagContribution& Contribution = Arena.Contributions[Index];
+	Contribution.Tag = Tag;
+	Contribution.Source = Source;
+	Contribution.StackCount = StackCount;
+	Contribution.PrevIndex = INDEX_NONE;
+	Contribution.NextIndex = FirstSourceIndex;
+
+	if (FirstSourceIndex != INDEX_NONE)
+	{
+		Arena.Contributions[FirstSourceIndex].PrevIndex = Index;
+	}
+
+	FirstSourceIndex = Index;
+
+	// Listeners notified by AddStack may change the arena
+	const FGTM_TagContributionHandle Handle(Index, Contribution.Serial, ContainerId);
+	AddStack(Tag, StackCount);
+	return Handle;
+}
+
+bool FGTM_GameplayTagStackContainer::RemoveContribution(const FGTM_TagContributionHandle& Handle)
+{
+	if (!ContributionArena || !ContributionArena->Contributions.IsValidIndex(Handle.Index)
+		|| Handle.ContainerId != ContainerId)
+	{
+		return false;
+	}
+
+	const GameplayTagManager::FTagContribution& Contribution = ContributionArena->Contributions[Handle.Index];
+	if (Contribution.IsFree() || Contribution.Serial != Handle.Serial)
+	{
+		return false;
+	}
+
+	const FGameplayTag Tag = Contribution.Tag;
+	const int32 StackCount = Contribution.StackCount;
+	FreeContribution(Handle.Index);
+
+	// The anonymous stacks may have been removed or overridden in the meantime
+	const int32 StacksToRemove = FMath::Min(StackCount, GetStackCount(Tag));
+	if (StacksToRemove > 0)
+	{
+		RemoveStack(Tag, StacksToRemove);
+	}
+
+	return true;
+}
+
+void FGTM_GameplayTagStackContainer::RemoveContributions(FObjectKey Source)
+{
+	if (!ContributionArena)
+	{
+		return;
+	}
+
+	// Gathered upfront, since listeners notified by the removals may change the arena
+	TArray<FGTM_TagContributionHandle, TInlineAllocator<8>> Handles;
+
+	const TArray<GameplayTagManager::FTagContribution>& Contributions = ContributionArena->Contributions;
+	const int32* FirstSourceIndex = ContributionArena->SourceToFirstContribution.Find(Source);
+	for (int32 Index = FirstSourceIndex ? *FirstSourceIndex : INDEX_NONE; Index != INDEX_NONE;
+		Index = Contributions[Index].NextIndex)
+	{
+		Handles.Emplace(Index, Contributions[Index].Serial, ContainerId);
+	}
+
+	for (const FGTM_TagContributionHandle& Handle : Handles)
+	{
+		RemoveContribution(Handle);
+	}
+}
+
+bool FGTM_GameplayTagStackContainer::HasContributions(FObjectKey Source) const
+{
+	return ContributionArena && ContributionArena->SourceToFirstContribution.Contains(Source);
+}
+
+int32 FGTM_GameplayTagStackContainer::GetContributedStackCount(FObjectKey Source, FGameplayTag Tag) const
+{
+	if (!ContributionArena)
+	{
+		return 0;
+	}
+
+	int32 StackCount = 0;
+
+	const TArray<GameplayTagManager::FTagContribution>& Contributions = ContributionArena->Contributions;
+	const int32* FirstSourceIndex = ContributionArena->SourceToFirstContribution.Find(Source);
+	for (int32 Index = FirstSourceIndex ? *FirstSourceIndex : INDEX_NONE; Index != INDEX_NONE;
+		Index = Contributions[Index].NextIndex)
+	{
+		if (Contributions[Index].Tag == Tag)
+		{
+			StackCount += Contributions[Index].StackCount;
+		}
+	}
+
+	return StackCount;
+}
+
 const TMap<FGameplayTag, int32>& FGTM_GameplayTagStackContainer::GetTagToCountMap() const
 {
+	ensureMsgf(!bCompactStorage, TEXT("The tag to count map isn't maintained with compact storage"));
 	return TagToCountMap;
 }
 
 FGameplayTagContainer FGTM_GameplayTagStackContainer::GetTags() const
 {
+	if (bCompactStorage)
+	{
+		FGameplayTagContainer StackTags;
+		AppendTags(StackTags);
+		return StackTags;
+	}
+
 	return Tags;
 }
 
+EGTM_StackContainerId FGTM_GameplayTagStackContainer::GetContainerId() const
+{
+	return ContainerId;
+}
+
+void FGTM_GameplayTagStackContainer::AppendTagCounts(TMap<FGameplayTag, int32>& InOutTagToCount) const
+{
+	VisitStacks([&InOutTagToCount](const auto& InStacks)
+	{
+		for (const FGTM_GameplayTagStack& Stack : InStacks)
+		{
+			InOutTagToCount.FindOrAdd(Stack.Tag) += Stack.StackCount;
+		}
+	});
+}
+
+void FGTM_GameplayTagStackContainer::AppendTags(FGameplayTagContainer& InOutTags) const
+{
+	if (!bCompactStorage)
+	{
+		InOutTags.AppendTags(Tags);
+		return;
+	}
+
+	VisitStacks([&InOutTags](const auto& InStacks)
+	{
+		for (const FGTM_GameplayTagStack& Stack : InStacks)
+		{
+			InOutTags.AddTag(Stack.Tag);
+		}
+	});
+}
+
+void FGTM_GameplayTagStackContainer::SetCompactStorage(bool bInCompactStorage)
+{
+	if (bCompactStorage == bInCompactStorage)
+	{
+		return;
+	}
+
+	const bool bIsEmpty = VisitStacks([](const auto& InStacks)
+	{
+		return InStacks.IsEmpty();
+	});
+
+	if (!ensureMsgf(bIsEmpty, TEXT("Compact storage can only be toggled on an empty container")))
+	{
+		return;
+	}
+
+	bCompactStorage = bInCompactStorage;
+	TagToCountMap.Empty();
+	Tags.Reset();
+}
+
+bool FGTM_GameplayTagStackContainer::IsCompactStorage() const
+{
+	return bCompactStorage;
+}
+
+SIZE_T FGTM_GameplayTagStackContainer::GetAllocatedSize() const
+{
+	// Inline stacks are part of the owner, so only what spilled to the heap counts
+	const SIZE_T StacksSize = VisitStacks([](const auto& InStacks)
+	{
+		return InStacks.GetAllocatedSize();
+	});
+
+	SIZE_T Size = StacksSize
+		+ TagToCountMap.GetAllocatedSize()
+		+ GameplayTagManager::GetAllocatedSize(Tags)
+		+ ItemMap.GetAllocatedSize()
+		+ OnInternalsChangedDelegate.GetAllocatedSize()
+		+ OnStackCountChangedDelegate.GetAllocatedSize();
+
+	if (ContributionArena)
+	{
+		Size += sizeof(GameplayTagManager::FTagContributionArena)
+			+ ContributionArena->Contributions.GetAllocatedSize()
+			+ ContributionArena->SourceToFirstContribution.GetAllocatedSize();
+	}
+
+	return Size;
+}
+
 void FGTM_GameplayTagStackContainer::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
 {
 	for (int32 Index : RemovedIndices)
 	{
 		OnStackRemoved(Stacks[Index]);
 
-		const FGameplayTag Tag = Stacks[Index].Tag;
-		TagToCountMap.Remove(Tag);
-		Tags.RemoveTag(Tag);
+		if (!bCompactStorage)
+		{
+			const FGameplayTag Tag = Stacks[Index].Tag;
+			TagToCountMap.Remove(Tag);
+			Tags.RemoveTag(Tag);
+		}
 	}
 
 	bHasChangedAnything |= !RemovedIndices.IsEmpty();
@@ -198,9 +486,14 @@ void FGTM_GameplayTagStackContainer::PostReplicatedAdd(const TArrayView<int32> A
 {
 	for (int32 Index : AddedIndices)
 	{
-		const FGTM_GameplayTagStack& Stack = Stacks[Index];
-		TagToCountMap.Add(Stack.Tag, Stack.StackCount);
-		Tags.AddTag(Stack.Tag);
+		FGTM_GameplayTagStack& Stack = Stacks[Index];
+		Stack.PreviousStackCount = Stack.StackCount;
+
+		if (!bCompactStorage)
+		{
+			TagToCountMap.Add(Stack.Tag, Stack.StackCount);
+			Tags.AddTag(Stack.Tag);
+		}
 
 		OnStackAdded(Stack);
 	}
@@ -212,9 +505,14 @@ void FGTM_GameplayTagStackContainer::PostReplicatedChange(const TArrayView<int32
 {
 	for (int32 Index : ChangedIndices)
 	{
-		const FGTM_GameplayTagStack& Stack = Stacks[Index];
-		const int32 OldCount = TagToCountMap[Stack.Tag];
-		TagToCountMap[Stack.Tag] = Stack.StackCount;
+		FGTM_GameplayTagStack& Stack = Stacks[Index];
+		const int32 OldCount = Stack.PreviousStackCount;
+		Stack.PreviousStackCount = Stack.StackCount;
+
+		if (!bCompactStorage)
+		{
+			TagToCountMap[Stack.Tag] = Stack.StackCount;
+		}
 
 		OnStackChanged(Stack, OldCount);
 	}
@@ -224,9 +522,43 @@ void FGTM_GameplayTagStackContainer::PostReplicatedChange(const TArrayView<int32
 
 bool FGTM_GameplayTagStackContainer::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
 {
+	if (!ensureMsgf(!LocalStacks, TEXT("A container with local stacks can't be replicated")))
+	{
+		return false;
+	}
+
+#if STATS
+	const int64 StartBits = DeltaParms.Writer ? DeltaParms.Writer->GetNumBits() : 0;
+#endif
+
 	const bool bReturnValue = FastArrayDeltaSerialize<FGTM_GameplayTagStack, FGTM_GameplayTagStackContainer>(
 		Stacks, DeltaParms, *this);
 
+#if STATS
+	if (DeltaParms.Writer)
+	{
+		const uint32 WrittenBytes = static_cast<uint32>(
+			FMath::DivideAndRoundUp<int64>(DeltaParms.Writer->GetNumBits() - StartBits, 8));
+		switch (ContainerId)
+		{
+			case EGTM_StackContainerId::Replicated:
+				INC_DWORD_STAT_BY(STAT_GTM_ReplicatedBytes_Replicated, WrittenBytes);
+				break;
+			case EGTM_StackContainerId::OwnerOnly:
+				INC_DWORD_STAT_BY(STAT_GTM_ReplicatedBytes_OwnerOnly, WrittenBytes);
+				break;
+			case EGTM_StackContainerId::Custom:
+				INC_DWORD_STAT_BY(STAT_GTM_ReplicatedBytes_Custom, WrittenBytes);
+				break;
+			case EGTM_StackContainerId::Authoritative:
+				INC_DWORD_STAT_BY(STAT_GTM_ReplicatedBytes_Authoritative, WrittenBytes);
+				break;
+			default:
+				break;
+		}
+	}
+#endif
+
 	if (bHasChangedAnything)
 	{
 		bHasChangedAnything = false;
@@ -236,13 +568,39 @@ bool FGTM_GameplayTagStackContainer::NetDeltaSerialize(FNetDeltaSerializeInfo& D
 	return bReturnValue;
 }
 
+FGTM_GameplayTagStack* FGTM_GameplayTagStackContainer::FindStack(FGameplayTag Tag)
+{
+	return VisitStacks([Tag](auto& InStacks)
+	{
+		return InStacks.FindByPredicate([Tag](const FGTM_GameplayTagStack& Stack)
+		{
+			return Stack.Tag == Tag;
+		});
+	});
+}
+
+const FGTM_GameplayTagStack* FGTM_GameplayTagStackContainer::FindStack(FGameplayTag Tag) const
+{
+	return const_cast<FGTM_GameplayTagStackContainer*>(this)->FindStack(Tag);
+}
+
 void FGTM_GameplayTagStackContainer::AddNewStackImpl(FGameplayTag InTag, int32 InStackCount)
 {
-	FGTM_GameplayTagStack& NewStack = Stacks.Emplace_GetRef(InTag, InStackCount);
-	MarkItemDirty(NewStack);
+	FGTM_GameplayTagStack& NewStack = VisitStacks([InTag, InStackCount](auto& InStacks) -> FGTM_GameplayTagStack&
+	{
+		return InStacks.Emplace_GetRef(InTag, InStackCount);
+	});
 
-	TagToCountMap.Add(InTag, InStackCount);
-	Tags.AddTag(InTag);
+	if (!LocalStacks)
+	{
+		MarkItemDirty(NewStack);
+	}
+
+	if (!bCompactStorage)
+	{
+		TagToCountMap.Add(InTag, InStackCount);
+		Tags.AddTag(InTag);
+	}
 
 	OnStackAdded(NewStack);
 	BroadcastStateChanged();
@@ -252,9 +610,21 @@ void FGTM_GameplayTagStackContainer::SetExistingStackCountImpl(FGTM_GameplayTagS
 {
 	const int32 OldCount = InStack.StackCount;
 	InStack.StackCount = InNewCount;
-	MarkItemDirty(InStack);
 
-	TagToCountMap[InStack.Tag] = InNewCount;
+	if (!LocalStacks)
+	{
+		MarkItemDirty(InStack);
+	}
+
+	if (InNewCount < OldCount)
+	{
+		ClampContributions(InStack.Tag, InNewCount);
+	}
+
+	if (!bCompactStorage)
+	{
+		TagToCountMap[InStack.Tag] = InNewCount;
+	}
 
 	OnStackChanged(InStack, OldCount);
 	BroadcastStateChanged();
@@ -262,10 +632,18 @@ void FGTM_GameplayTagStackContainer::SetExistingStackCountImpl(FGTM_GameplayTagS
 
 void FGTM_GameplayTagStackContainer::RemoveStackImpl(FGTM_GameplayTagStack& InStack)
 {
-	MarkArrayDirty();
+	if (!LocalStacks)
+	{
+		MarkArrayDirty();
+	}
 
-	TagToCountMap.Remove(InStack.Tag);
-	Tags.RemoveTag(InStack.Tag);
+	ClampContributions(InStack.Tag, 0);
+
+	if (!bCompactStorage)
+	{
+		TagToCountMap.Remove(InStack.Tag);
+		Tags.RemoveTag(InStack.Tag);
+	}
 
 	OnStackRemoved(InStack);
 	BroadcastStateChanged();
@@ -273,35 +651,156 @@ void FGTM_GameplayTagStackContainer::RemoveStackImpl(FGTM_GameplayTagStack& InSt
 
 void FGTM_GameplayTagStackContainer::OnStackAdded(const FGTM_GameplayTagStack& InStack)
 {
-#if USE_LOGGING_IN_SHIPPING
-	LOGVSC(Owner.Get(), .Category(LogGameplayTagManager).VisualLogText(Owner.Get(), false),
-		"Add {0} tag [{1}]", Type, InStack);
-#endif
+	GTM_LOG_TAG_MUTATION(AddRemove, Owner.Get(), ContainerId, InStack.Tag, 0, InStack.StackCount);
+
+	GTM_TRACE_TAG_CHANGED(Owner.Get(), ContainerId, InStack.Tag, 0, InStack.StackCount);
+	GTM_JOURNAL_TAG_CHANGED(Owner.Get(), ContainerId, InStack.Tag, 0, InStack.StackCount);
+	GTM_RECORD_TAG_CHURN(Mutation, Owner.Get(), InStack.Tag);
 
 	ensure(InStack.StackCount > 0);
+
+	OnStackCountChangedDelegate.ExecuteIfBound(InStack.Tag, 0, InStack.StackCount);
 }
 
 void FGTM_GameplayTagStackContainer::OnStackChanged(const FGTM_GameplayTagStack& InStack, int32 OldCount)
 {
-#if USE_LOGGING_IN_SHIPPING
-	LOGVSC(Owner.Get(), .Category(LogGameplayTagManager).VisualLogText(Owner.Get(), false),
-		"Change {0} tag [{1}]. Old count {2}", Type, InStack, OldCount);
-#endif
+	GTM_LOG_TAG_MUTATION(Change, Owner.Get(), ContainerId, InStack.Tag, OldCount, InStack.StackCount);
+
+	GTM_TRACE_TAG_CHANGED(Owner.Get(), ContainerId, InStack.Tag, OldCount, InStack.StackCount);
+	GTM_JOURNAL_TAG_CHANGED(Owner.Get(), ContainerId, InStack.Tag, OldCount, InStack.StackCount);
+	GTM_RECORD_TAG_CHURN(Mutation, Owner.Get(), InStack.Tag);
 
 	ensure(InStack.StackCount > 0);
+
+	OnStackCountChangedDelegate.ExecuteIfBound(InStack.Tag, OldCount, InStack.StackCount);
 }
 
 void FGTM_GameplayTagStackContainer::OnStackRemoved(const FGTM_GameplayTagStack& InStack)
 {
-#if USE_LOGGING_IN_SHIPPING
-	LOGVSC(Owner.Get(), .Category(LogGameplayTagManager).VisualLogText(Owner.Get(), false),
-		"Remove {0} tag [{1}]", Type, InStack);
-#endif
+	GTM_LOG_TAG_MUTATION(AddRemove, Owner.Get(), ContainerId, InStack.Tag, InStack.StackCount, 0);
+
+	GTM_TRACE_TAG_CHANGED(Owner.Get(), ContainerId, InStack.Tag, InStack.StackCount, 0);
+	GTM_JOURNAL_TAG_CHANGED(Owner.Get(), ContainerId, InStack.Tag, InStack.StackCount, 0);
+	GTM_RECORD_TAG_CHURN(Mutation, Owner.Get(), InStack.Tag);
 
 	ensure(InStack.StackCount > 0);
+
+	OnStackCountChangedDelegate.ExecuteIfBound(InStack.Tag, InStack.StackCount, 0);
 }
 
 void FGTM_GameplayTagStackContainer::BroadcastStateChanged()
 {
-	OnInternalsChangedDelegate.Execute();
+	// Unbound for channels no route targets, as they never hold any stacks
+	OnInternalsChangedDelegate.ExecuteIfBound();
+}
+
+GameplayTagManager::FTagContributionArena& FGTM_GameplayTagStackContainer::GetOrCreateContributionArena()
+{
+	if (!ContributionArena)
+	{
+		ContributionArena = MakeUnique<GameplayTagManager::FTagContributionArena>();
+	}
+
+	return *ContributionArena;
+}
+
+void FGTM_GameplayTagStackContainer::FreeContribution(int32 Index)
+{
+	TArray<GameplayTagManager::FTagContribution>& Contributions = ContributionArena->Contributions;
+	TMap<FObjectKey, int32>& SourceToFirstContribution = ContributionArena->SourceToFirstContribution;
+	GameplayTagManager::FTagContribution& Contribution = Contributions[Index];
+
+	// Unlink from the source's list
+	if (Contribution.PrevIndex != INDEX_NONE)
+	{
+		Contributions[Contribution.PrevIndex].NextIndex = Contribution.NextIndex;
+	}
+	else if (Contribution.NextIndex != INDEX_NONE)
+	{
+		SourceToFirstContribution[Contribution.Source] = Contribution.NextIndex;
+	}
+	else
+	{
+		SourceToFirstContribution.Remove(Contribution.Source);
+	}
+
+	if (Contribution.NextIndex != INDEX_NONE)
+	{
+		Contributions[Contribution.NextIndex].PrevIndex = Contribution.PrevIndex;
+	}
+
+	// Serial 0 is skipped so that default handles never match
+	Contribution.Serial = Contribution.Serial == MAX_uint16 ? 1 : Contribution.Serial + 1;
+	Contribution.Tag = FGameplayTag::EmptyTag;
+	Contribution.Source = FObjectKey();
+	Contribution.StackCount = 0;
+	Contribution.PrevIndex = INDEX_NONE;
+	Contribution.NextIndex = ContributionArena->FirstFreeContribution;
+	ContributionArena->FirstFreeContribution = Index;
+}
+
+void FGTM_GameplayTagStackContainer::ClampContributions(FGameplayTag Tag, int32 StackCount)
+{
+	if (!ContributionArena || ContributionArena->SourceToFirstContribution.IsEmpty())
+	{
+		return;
+	}
+
+	// Free slots have no tag, so they never match
+	TArray<GameplayTagManager::FTagContribution>& Contributions = ContributionArena->Contributions;
+	int32 ContributedStackCount = 0;
+	for (const GameplayTagManager::FTagContribution& Contribution : Contributions)
+	{
+		if (Contribution.Tag == Tag)
+		{
+			ContributedStackCount += Contribution.StackCount;
+		}
+	}
+
+	// Take the excess from the newest slots first; freeing a slot invalidates the handles to it
+	int32 ExcessStackCount = ContributedStackCount - StackCount;
+	for (int32 Index = Contributions.Num() - 1; Index >= 0 && ExcessStackCount > 0; --Index)
+	{
+		GameplayTagManager::FTagContribution& Contribution = Contributions[Index];
+		if (Contribution.Tag != Tag)
+		{
+			continue;
+		}
+
+		const int32 TakenStackCount = FMath::Min(ExcessStackCount, Contribution.StackCount);
+		ExcessStackCount -= TakenStackCount;
+
+		if (TakenStackCount == Contribution.StackCount)
+		{
+			FreeContribution(Index);
+		}
+		else
+		{
+			Contribution.StackCount -= TakenStackCount;
+		}
+	}
+}
+
+FGTM_LocalTagStackContainer::FGTM_LocalTagStackContainer()
+	: FGTM_LocalTagStackContainer(nullptr, EGTM_StackContainerId::Loose)
+{
+}
+
+FGTM_LocalTagStackContainer::FGTM_LocalTagStackContainer(UActorComponent* InOwner,
+	EGTM_StackContainerId InContainerId)
+	: FGTM_GameplayTagStackContainer(InOwner, InContainerId, InlineStacks)
+{
+}
+
+FGTM_LocalTagStackContainer::FGTM_LocalTagStackContainer(const FGTM_LocalTagStackContainer& Other)
+	: FGTM_LocalTagStackContainer()
+{
+	*this = Other;
+}
+
+FGTM_LocalTagStackContainer& FGTM_LocalTagStackContainer::operator=(const FGTM_LocalTagStackContainer& Other)
+{
+	// Copies the stacks into the inline array this container points to
+	FGTM_GameplayTagStackContainer::operator=(Other);
+	return *this;
 }
@@ -0,0 +1,95 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Gameplay/Misc/GTM_GameplayTagTypes.h"
+
+const TCHAR* LexToString(EGTM_StackContainerId ContainerId)
+{
+	switch (ContainerId)
+	{
+		case EGTM_StackContainerId::Replicated:
+			return TEXT("Replicated");
+		case EGTM_StackContainerId::OwnerOnly:
+			return TEXT("OwnerOnly");
+		case EGTM_StackContainerId::Custom:
+			return TEXT("Custom");
+		case EGTM_StackContainerId::Loose:
+			return TEXT("Loose");
+		case EGTM_StackContainerId::Authoritative:
+			return TEXT("Authoritative");
+		default:
+			return TEXT("Invalid");
+	}
+}
+
+SIZE_T FGTM_TagManagerMemoryUsage::GetTotal() const
+{
+	SIZE_T Total = Object + CachedTags + Listeners + Events;
+	for (const SIZE_T ContainerSize : Containers)
+	{
+		Total += ContainerSize;
+	}
+
+	return Total;
+}
+
+FGTM_TagManagerMemoryUsage& FGTM_TagManagerMemoryUsage::operator+=(const FGTM_TagManagerMemoryUsage& Other)
+{
+	Object += Other.Object;
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(Containers); ++Index)
+	{
+		Containers[Index] += Other.Containers[Index];
+	}
+
+	CachedTags += Other.CachedTags;
+	Listeners += Other.Listeners;
+	Events += Other.Events;
+	return *this;
+}
+
+namespace GameplayTagManager
+{
+	SIZE_T GetAllocatedSize(const FGameplayTagContainer& Container)
+	{
+		const TArray<FGameplayTag>& ExplicitTags = Container.GetGameplayTagArray();
+		if (ExplicitTags.IsEmpty())
+		{
+			return ExplicitTags.GetAllocatedSize();
+		}
+
+		const int32 NumParentTags = Container.GetGameplayTagParents().Num() - ExplicitTags.Num();
+		return ExplicitTags.GetAllocatedSize() + FMath::Max(NumParentTags, 0) * sizeof(FGameplayTag);
+	}
+}
+
+FGTM_TagOperation::FGTM_TagOperation(FGameplayTag InTag, EGTM_TagMutationType InMutation, int32 InCount,
+	EGTM_TagContainerType InContainer)
+	: Tag(InTag)
+	, Mutation(InMutation)
+	, Count(InCount)
+	, Container(InContainer)
+{
+}
+
+FGTM_TagContributionHandle::FGTM_TagContributionHandle(int32 InIndex, uint16 InSerial,
+	EGTM_StackContainerId InContainerId)
+	: Index(InIndex)
+	, Serial(InSerial)
+	, ContainerId(InContainerId)
+{
+}
+
+bool FGTM_TagContributionHandle::IsValid() const
+{
+	return Index != INDEX_NONE;
+}
+
+bool FGTM_TagContributionHandle::operator==(const FGTM_TagContributionHandle& Rhs) const
+{
+	return Index == Rhs.Index && Serial == Rhs.Serial && ContainerId == Rhs.ContainerId;
+}
+
+uint32 GetTypeHash(const FGTM_TagContributionHandle& Handle)
+{
+	return HashCombine(GetTypeHash(Handle.Index),
+		GetTypeHash(static_cast<uint32>(Handle.Serial) << 8 | static_cast<uint32>(Handle.ContainerId)));
+}
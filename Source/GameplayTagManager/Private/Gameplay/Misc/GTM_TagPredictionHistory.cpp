@@ -0,0 +1,50 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Gameplay/Misc/GTM_TagPredictionHistory.h"
+
+#include "GameplayTagManagerModule.h"
+#include "Gameplay/Misc/GameplayTagManager.h"
+
+uint16 FGTM_TagPredictionHistory::Record(FGameplayTag Tag, int32 Delta)
+{
+	const uint16 Key = NextKey;
+	NextKey = NextKey == MAX_uint16 ? 1 : NextKey + 1;
+
+	FEntry& Entry = Entries[Key % Capacity];
+	if (Entry.bPending)
+	{
+		LOGV(.Category(LogGameplayTagManager).Warn(), "Predicted tag change [{0}] with key {1} was evicted before "
+			"the server replied; it can no longer be rolled back. Consider predicting fewer changes at once.",
+			Entry.Tag, Entry.Key);
+	}
+
+	Entry.Tag = Tag;
+	Entry.Delta = Delta;
+	Entry.Key = Key;
+	Entry.bPending = true;
+
+	return Key;
+}
+
+bool FGTM_TagPredictionHistory::Consume(uint16 Key, FEntry& OutEntry)
+{
+	FEntry& Entry = Entries[Key % Capacity];
+	if (!Entry.bPending || Entry.Key != Key)
+	{
+		return false;
+	}
+
+	Entry.bPending = false;
+	OutEntry = Entry;
+	return true;
+}
+
+void FGTM_TagPredictionHistory::Reset()
+{
+	for (FEntry& Entry : Entries)
+	{
+		Entry = FEntry();
+	}
+
+	NextKey = 1;
+}
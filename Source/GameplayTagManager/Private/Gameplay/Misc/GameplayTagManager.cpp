@@ -1,12 +1,20 @@
-// Author: Antonio Sidenko (Tonetfal), June 2025
+﻿// Author: Antonio Sidenko (Tonetfal), June 2025
 
 #include "Gameplay/Misc/GameplayTagManager.h"
 
 #include "GameplayTagManagerModule.h"
+#include "Engine/World.h"
 #include "GameFramework/HUD.h"
+#include "Gameplay/Misc/GTM_GameplayTagManagerSubsystem.h"
+#include "Net/Core/PropertyConditions/PropertyConditions.h"
 #include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
 #include "Profiling/GTM_Profiling.h"
+#include "Profiling/GTM_TagChurn.h"
+#include "Profiling/GTM_TagJournal.h"
+#include "Settings/GTM_GameplayTagManagerSettings.h"
+#include "TimerManager.h"
+#include "UObject/UObjectIterator.h"
 
 namespace
 {
@@ -16,13 +24,98 @@ namespace
 		ResultContainer.RemoveTags(Filter);
 		return ResultContainer;
 	}
+
+	void ApplyTagMutation(FGTM_GameplayTagStackContainer& Container, FGameplayTag Tag,
+		EGTM_TagMutationType Mutation, int32 Count)
+	{
+		switch (Mutation)
+		{
+			case EGTM_TagMutationType::Add:
+				Container.AddStack(Tag, Count);
+				break;
+			case EGTM_TagMutationType::Remove:
+				Container.RemoveStack(Tag, Count);
+				break;
+			case EGTM_TagMutationType::Override:
+				Container.OverrideStack(Tag, Count);
+				break;
+		}
+	}
+
+	template<typename MapType>
+	SIZE_T GetListenersAllocatedSize(const MapType& Listeners)
+	{
+		SIZE_T Size = Listeners.GetAllocatedSize();
+		for (const auto& [Tag, Delegate] : Listeners)
+		{
+			Size += Delegate.GetAllocatedSize();
+		}
+
+		return Size;
+	}
+
+	void PrintMemoryUsage(FOutputDevice& Ar, const TCHAR* Label, SIZE_T Bytes, int32 NumManagers)
+	{
+		Ar.Logf(TEXT("  %-16s %10.2f KB total %10.1f B per manager"), Label, Bytes / 1024.0,
+			NumManagers > 0 ? static_cast<double>(Bytes) / NumManagers : 0.0);
+	}
+
+	void DumpMemoryUsage(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const bool bAllWorlds = Args.Contains(TEXT("-All"));
+		const bool bVerbose = Args.Contains(TEXT("-Verbose"));
+
+		FGTM_TagManagerMemoryUsage TotalUsage;
+		int32 NumManagers = 0;
+		int32 NumTags = 0;
+		for (TObjectIterator<UGameplayTagManager> It; It; ++It)
+		{
+			const UGameplayTagManager* TagManager = *It;
+			if (TagManager->IsTemplate() || (!bAllWorlds && TagManager->GetWorld() != World))
+			{
+				continue;
+			}
+
+			const FGTM_TagManagerMemoryUsage Usage = TagManager->GetMemoryUsage();
+			TotalUsage += Usage;
+			NumManagers++;
+			NumTags += TagManager->GetTagsToCount().Num();
+
+			if (bVerbose)
+			{
+				Ar.Logf(TEXT("  %s: %llu B, %d tags"), *GetPathNameSafe(TagManager),
+					static_cast<uint64>(Usage.GetTotal()), TagManager->GetTagsToCount().Num());
+			}
+		}
+
+		Ar.Logf(TEXT("Gameplay tag managers: %d, tags: %d, total %.2f KB"), NumManagers, NumTags,
+			TotalUsage.GetTotal() / 1024.0);
+		PrintMemoryUsage(Ar, TEXT("Object"), TotalUsage.Object, NumManagers);
+		for (int32 Index = 0; Index < UE_ARRAY_COUNT(TotalUsage.Containers); ++Index)
+		{
+			PrintMemoryUsage(Ar, LexToString(static_cast<EGTM_StackContainerId>(Index)), TotalUsage.Containers[Index],
+				NumManagers);
+		}
+
+		PrintMemoryUsage(Ar, TEXT("CachedTags"), TotalUsage.CachedTags, NumManagers);
+		PrintMemoryUsage(Ar, TEXT("Listeners"), TotalUsage.Listeners, NumManagers);
+		PrintMemoryUsage(Ar, TEXT("Events"), TotalUsage.Events, NumManagers);
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice MemReportCommand(
+		TEXT("gtm.MemReport"),
+		TEXT("Prints the memory used by the gameplay tag managers of the current world, broken down by part. "
+			"-All includes every world, -Verbose lists every manager."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&DumpMemoryUsage));
 }
 
 UGameplayTagManager::UGameplayTagManager(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
-	, ReplicatedStateTagsContainer(this, "Replicated")
-	, LooseStateTagsContainer(this, "Loose")
-	, AuthoritativeStateTagsContainer(this, "Authoritative")
+	, ReplicatedStateTagsContainer(this, EGTM_StackContainerId::Replicated)
+	, OwnerOnlyStateTagsContainer(this, EGTM_StackContainerId::OwnerOnly)
+	, CustomStateTagsContainer(this, EGTM_StackContainerId::Custom)
+	, LooseStateTagsContainer(this, EGTM_StackContainerId::Loose)
+	, AuthoritativeStateTagsContainer(this, EGTM_StackContainerId::Authoritative)
 {
 	PrimaryComponentTick.bCanEverTick = false;
 	PrimaryComponentTick.bStartWithTickEnabled = false;
@@ -52,6 +145,17 @@ void UGameplayTagManager::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ReplicatedStateTagsContainer, Params);
 
+	// Channels no route targets never hold any tags, so they don't need any per-connection replication state
+	const UGTM_GameplayTagManagerSettings* Settings = UGTM_GameplayTagManagerSettings::Get();
+
+	Params.Condition = Settings->IsChannelRouted(EGTM_ReplicationChannel::OwnerOnly) ? COND_OwnerOnly : COND_Never;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, OwnerOnlyStateTagsContainer, Params);
+
+	Params.Condition = Settings->IsChannelRouted(EGTM_ReplicationChannel::Custom)
+		? Settings->GetCustomChannelLifetimeCondition()
+		: COND_Never;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, CustomStateTagsContainer, Params);
+
 	Params.Condition = COND_SkipOwner;
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, AuthoritativeStateTagsContainer, Params);
 }
@@ -60,9 +164,22 @@ void UGameplayTagManager::InitializeComponent()
 {
 	Super::InitializeComponent();
 
-	ReplicatedStateTagsContainer.OnInternalsChangedDelegate.BindUObject(this, &ThisClass::NotifyTagsChanged);
-	LooseStateTagsContainer.OnInternalsChangedDelegate.BindUObject(this, &ThisClass::NotifyTagsChanged);
-	AuthoritativeStateTagsContainer.OnInternalsChangedDelegate.BindUObject(this, &ThisClass::NotifyTagsChanged);
+	for (int32 Index = 0; Index < static_cast<int32>(EGTM_StackContainerId::Num); ++Index)
+	{
+		GetContainer(static_cast<EGTM_StackContainerId>(Index)).SetCompactStorage(bCompactStorage);
+	}
+
+	// Delegates are bound on the heap, so containers that never hold any tags are left unbound
+	for (int32 Index = 0; Index < static_cast<int32>(EGTM_StackContainerId::Num); ++Index)
+	{
+		const auto ContainerId = static_cast<EGTM_StackContainerId>(Index);
+		if (IsContainerInUse(ContainerId))
+		{
+			FGTM_GameplayTagStackContainer& Container = GetContainer(ContainerId);
+			Container.OnInternalsChangedDelegate.BindUObject(this, &ThisClass::NotifyTagsChanged);
+			Container.OnStackCountChangedDelegate.BindUObject(this, &ThisClass::OnStackCountChanged);
+		}
+	}
 
 	if (!IsRunningDedicatedServer())
 	{
@@ -72,6 +189,90 @@ void UGameplayTagManager::InitializeComponent()
 	}
 }
 
+void UGameplayTagManager::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (auto* Subsystem = GetWorld()->GetSubsystem<UGTM_GameplayTagManagerSubsystem>())
+	{
+		Subsystem->RegisterManager(this);
+	}
+
+	if (bDriveOwnerNetDormancy && GetOwnerRole() == ROLE_Authority)
+	{
+		LastReplicatedTagsChangeTime = GetWorld()->GetTimeSeconds();
+		ScheduleOwnerNetDormancy(NetDormancyIdleTime);
+	}
+}
+
+void UGameplayTagManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(NetDormancyTimerHandle);
+
+		if (auto* Subsystem = World->GetSubsystem<UGTM_GameplayTagManagerSubsystem>())
+		{
+			Subsystem->UnregisterManager(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UGameplayTagManager::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	if (!PendingEventTags.IsEmpty())
+	{
+		MulticastEventTags(PendingEventTags);
+		PendingEventTags.Reset();
+	}
+}
+
+void UGameplayTagManager::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	const FGTM_TagManagerMemoryUsage Usage = GetMemoryUsage();
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Usage.GetTotal() - Usage.Object);
+}
+
+FGTM_TagManagerMemoryUsage UGameplayTagManager::GetMemoryUsage() const
+{
+	FGTM_TagManagerMemoryUsage Usage;
+	Usage.Object = GetClass()->GetStructureSize();
+
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(Usage.Containers); ++Index)
+	{
+		Usage.Containers[Index] = GetContainer(static_cast<EGTM_StackContainerId>(Index)).GetAllocatedSize();
+	}
+
+	Usage.CachedTags = CachedTagsCount.GetAllocatedSize()
+		+ GameplayTagManager::GetAllocatedSize(CachedTags)
+		+ GameplayTagManager::GetAllocatedSize(LastKnownTags);
+
+	Usage.Listeners = OnTagsChangedDelegate.GetAllocatedSize()
+		+ OnTagsChangeSimpleDelegate.GetAllocatedSize()
+		+ OnTagCountChangedSimpleDelegate.GetAllocatedSize()
+		+ PendingCountChanges.GetAllocatedSize();
+
+	if (ListenerTables)
+	{
+		Usage.Listeners += sizeof(FListenerTables)
+			+ GetListenersAllocatedSize(ListenerTables->SingleListeners)
+			+ GetListenersAllocatedSize(ListenerTables->SingleSimpleListeners)
+			+ GetListenersAllocatedSize(ListenerTables->EventListeners)
+			+ GetListenersAllocatedSize(ListenerTables->EventSimpleListeners)
+			+ GetListenersAllocatedSize(ListenerTables->CountListeners);
+	}
+
+	Usage.Events = GameplayTagManager::GetAllocatedSize(PendingEventTags);
+
+	return Usage;
+}
+
 FGameplayTagContainer UGameplayTagManager::GetTags() const
 {
 	return CachedTags;
@@ -84,6 +285,8 @@ const TMap<FGameplayTag, int32>& UGameplayTagManager::GetTagsToCount() const
 
 int32 UGameplayTagManager::GetTagCount(FGameplayTag Tag) const
 {
+	INC_DWORD_STAT(STAT_GTM_Queries);
+
 	const int32* FoundCount = CachedTagsCount.Find(Tag);
 	return FoundCount ? *FoundCount : 0;
 }
@@ -95,6 +298,8 @@ bool UGameplayTagManager::HasTag(FGameplayTag Tag, bool bExact) const
 
 bool UGameplayTagManager::HasTags(FGameplayTagContainer Tags, bool bExact) const
 {
+	INC_DWORD_STAT(STAT_GTM_Queries);
+
 	const FGameplayTagContainer AllTags = GetTags();
 	const bool bReturnValue = bExact ? AllTags.HasAnyExact(Tags) : AllTags.HasAny(Tags);
 	return bReturnValue;
@@ -102,6 +307,8 @@ bool UGameplayTagManager::HasTags(FGameplayTagContainer Tags, bool bExact) const
 
 bool UGameplayTagManager::HasAllTags(FGameplayTagContainer Tags, bool bExact) const
 {
+	INC_DWORD_STAT(STAT_GTM_Queries);
+
 	const FGameplayTagContainer AllTags = GetTags();
 	const bool bReturnValue = bExact ? AllTags.HasAllExact(Tags) : AllTags.HasAll(Tags);
 	return bReturnValue;
@@ -109,7 +316,7 @@ bool UGameplayTagManager::HasAllTags(FGameplayTagContainer Tags, bool bExact) co
 
 void UGameplayTagManager::BindGameplayTagListener(FOnTagChangedSignature Delegate, FGameplayTag Tag, bool bFireDelegate)
 {
-	auto& MulticastDelegate = SingleListeners.FindOrAdd(Tag);
+	auto& MulticastDelegate = GetOrCreateListenerTables().SingleListeners.FindOrAdd(Tag);
 	if (ensureAlwaysMsgf(!MulticastDelegate.Contains(Delegate),
 		TEXT("Binding same delegate to a dynamic delegate is incorrect. Fix your higher level code")))
 	{
@@ -124,7 +331,7 @@ void UGameplayTagManager::BindGameplayTagListener(FOnTagChangedSignature Delegat
 
 void UGameplayTagManager::UnbindGameplayTagListener(FOnTagChangedSignature Delegate, FGameplayTag Tag)
 {
-	auto* Signatures = SingleListeners.Find(Tag);
+	auto* Signatures = ListenerTables ? ListenerTables->SingleListeners.Find(Tag) : nullptr;
 	if (Signatures)
 	{
 		Signatures->Remove(Delegate);
@@ -133,13 +340,112 @@ void UGameplayTagManager::UnbindGameplayTagListener(FOnTagChangedSignature Deleg
 
 FDelegateHandle UGameplayTagManager::BindGameplayTagListener(FOnTagChangedSimpleSignature Delegate, FGameplayTag Tag)
 {
-	auto& Signatures = SingleSimpleListeners.FindOrAdd(Tag);
+	auto& Signatures = GetOrCreateListenerTables().SingleSimpleListeners.FindOrAdd(Tag);
 	return Signatures.Add(Delegate);
 }
 
 void UGameplayTagManager::UnbindGameplayTagListener(FDelegateHandle Handle)
 {
-	for (auto& [Tag, MulticastDelegate] : SingleSimpleListeners)
+	if (!ListenerTables)
+	{
+		return;
+	}
+
+	for (auto& [Tag, MulticastDelegate] : ListenerTables->SingleSimpleListeners)
+	{
+		if (MulticastDelegate.Remove(Handle))
+		{
+			return;
+		}
+	}
+}
+
+FDelegateHandle UGameplayTagManager::BindTagCountListener(FOnTagCountChangedSimpleSignature::FDelegate Delegate,
+	FGameplayTag Tag)
+{
+	auto& Signatures = GetOrCreateListenerTables().CountListeners.FindOrAdd(Tag);
+	return Signatures.Add(Delegate);
+}
+
+void UGameplayTagManager::UnbindTagCountListener(FDelegateHandle Handle)
+{
+	if (!ListenerTables)
+	{
+		return;
+	}
+
+	for (auto It = ListenerTables->CountListeners.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Remove(Handle))
+		{
+			// Empty entries would keep the count changes gathered for nothing
+			if (!It.Value().IsBound())
+			{
+				It.RemoveCurrent();
+			}
+
+			return;
+		}
+	}
+}
+
+void UGameplayTagManager::SendEventTag(FGameplayTag EventTag, bool bReplicate)
+{
+	if (!ensureMsgf(EventTag.IsValid(), TEXT("An invalid tag was passed to SendEventTag")))
+	{
+		return;
+	}
+
+	BroadcastEventTag(EventTag);
+
+	// Pending events are only drained by PreReplication, which never runs for owners that don't replicate
+	AActor* Owner = GetOwner();
+	if (bReplicate && GetOwnerRole() == ROLE_Authority && Owner->GetIsReplicated()
+		&& Owner->GetNetMode() != NM_Standalone)
+	{
+		// Dormant actors don't send RPCs, so the pending events need the owner to replicate at least once
+		if (Owner->NetDormancy > DORM_Awake)
+		{
+			Owner->FlushNetDormancy();
+		}
+
+		PendingEventTags.AddTag(EventTag);
+	}
+}
+
+void UGameplayTagManager::BindEventTagListener(FOnEventTagSignature Delegate, FGameplayTag EventTag)
+{
+	auto& MulticastDelegate = GetOrCreateListenerTables().EventListeners.FindOrAdd(EventTag);
+	if (ensureAlwaysMsgf(!MulticastDelegate.Contains(Delegate),
+		TEXT("Binding same delegate to a dynamic delegate is incorrect. Fix your higher level code")))
+	{
+		MulticastDelegate.Add(Delegate);
+	}
+}
+
+void UGameplayTagManager::UnbindEventTagListener(FOnEventTagSignature Delegate, FGameplayTag EventTag)
+{
+	auto* Signatures = ListenerTables ? ListenerTables->EventListeners.Find(EventTag) : nullptr;
+	if (Signatures)
+	{
+		Signatures->Remove(Delegate);
+	}
+}
+
+FDelegateHandle UGameplayTagManager::BindEventTagListener(FOnEventTagSimpleSignature Delegate, FGameplayTag EventTag)
+{
+	auto& Signatures = GetOrCreateListenerTables().EventSimpleListeners.FindOrAdd(EventTag);
+	return Signatures.Add(Delegate);
+}
+
+void UGameplayTagManager::UnbindEventTagListener(FDelegateHandle Handle)
+{
+	if (!ListenerTables)
+	{
+		return;
+	}
+
+	for (auto& [Tag, MulticastDelegate] : ListenerTables->EventSimpleListeners)
 	{
 		if (MulticastDelegate.Remove(Handle))
 		{
@@ -148,14 +454,90 @@ void UGameplayTagManager::UnbindGameplayTagListener(FDelegateHandle Handle)
 	}
 }
 
+void UGameplayTagManager::BroadcastEventTag(FGameplayTag EventTag)
+{
+	if (!ListenerTables)
+	{
+		return;
+	}
+
+	// Gather the listeners first to allow them to bind or unbind while being broadcast
+	TArray<FOnEventTagMulticastSignature, TInlineAllocator<4>> MatchingListeners;
+	for (const auto& [Tag, Listeners] : ListenerTables->EventListeners)
+	{
+		if (EventTag.MatchesTag(Tag))
+		{
+			MatchingListeners.Add(Listeners);
+		}
+	}
+
+	TArray<FOnEventTagMulticastSimpleSignature, TInlineAllocator<4>> MatchingSimpleListeners;
+	for (const auto& [Tag, Listeners] : ListenerTables->EventSimpleListeners)
+	{
+		if (EventTag.MatchesTag(Tag))
+		{
+			MatchingSimpleListeners.Add(Listeners);
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_GTM_ListenerInvocations, MatchingListeners.Num() + MatchingSimpleListeners.Num());
+
+	for (const FOnEventTagMulticastSimpleSignature& Listeners : MatchingSimpleListeners)
+	{
+		GTM_RECORD_TAG_CHURN(ListenerCall, this, EventTag);
+		Listeners.Broadcast(this, EventTag);
+	}
+
+	for (const FOnEventTagMulticastSignature& Listeners : MatchingListeners)
+	{
+		GTM_RECORD_TAG_CHURN(ListenerCall, this, EventTag);
+		Listeners.Broadcast(this, EventTag);
+	}
+}
+
+void UGameplayTagManager::MulticastEventTags_Implementation(const FGameplayTagContainer& EventTags)
+{
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		// Already broadcast when sent
+		return;
+	}
+
+	const TArray<FGameplayTag>& EventTagsArray = EventTags.GetGameplayTagArray();
+	for (const FGameplayTag& EventTag : EventTagsArray)
+	{
+		BroadcastEventTag(EventTag);
+	}
+}
+
+void UGameplayTagManager::ApplyTagOperations(const TArray<FGTM_TagOperation>& Operations)
+{
+	ApplyTagOperationsImpl(Operations);
+	FlushPendingChanges();
+}
+
+bool UGameplayTagManager::AllowsParallelBulkMutation() const
+{
+	// Predictions send RPCs and fill the prediction history, neither of which may happen on a worker thread
+	return bAllowParallelBulkMutation && !ShouldPredictAuthoritativeTags();
+}
+
+double UGameplayTagManager::GetLastTagChangeTime() const
+{
+	return LastTagChangeTime;
+}
+
 FGameplayTagContainer UGameplayTagManager::GetReplicatedTags() const
 {
-	return ReplicatedStateTagsContainer.GetTags();
+	FGameplayTagContainer ReplicatedTags = ReplicatedStateTagsContainer.GetTags();
+	ReplicatedTags.AppendTags(OwnerOnlyStateTagsContainer.GetTags());
+	ReplicatedTags.AppendTags(CustomStateTagsContainer.GetTags());
+	return ReplicatedTags;
 }
 
 int32 UGameplayTagManager::GetReplicatedTagCount(FGameplayTag Tag) const
 {
-	return ReplicatedStateTagsContainer.GetStackCount(Tag);
+	return GetReplicatedContainer(Tag).GetStackCount(Tag);
 }
 
 void UGameplayTagManager::AddTag(FGameplayTag Tag)
@@ -165,8 +547,10 @@ void UGameplayTagManager::AddTag(FGameplayTag Tag)
 		return;
 	}
 
-	ReplicatedStateTagsContainer.AddStack(Tag, 1);
-	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ReplicatedStateTagsContainer, this);
+	FlushOwnerNetDormancy();
+
+	GetReplicatedContainer(Tag).AddStack(Tag, 1);
+	MarkReplicatedContainerDirty(Tag);
 }
 
 void UGameplayTagManager::AddTags(FGameplayTagContainer Tags)
@@ -185,8 +569,10 @@ void UGameplayTagManager::RemoveTag(FGameplayTag Tag)
 		return;
 	}
 
-	ReplicatedStateTagsContainer.RemoveStack(Tag, 1);
-	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ReplicatedStateTagsContainer, this);
+	FlushOwnerNetDormancy();
+
+	GetReplicatedContainer(Tag).RemoveStack(Tag, 1);
+	MarkReplicatedContainerDirty(Tag);
 }
 
 void UGameplayTagManager::RemoveTags(FGameplayTagContainer Tags)
@@ -210,11 +596,13 @@ void UGameplayTagManager::OverrideTags(FGameplayTagContainer Tags, int32 NewCoun
 		return;
 	}
 
+	FlushOwnerNetDormancy();
+
 	const TArray<FGameplayTag>& TagsArray = Tags.GetGameplayTagArray();
 	for (const FGameplayTag& Tag : TagsArray)
 	{
-		ReplicatedStateTagsContainer.OverrideStack(Tag, NewCount);
-		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ReplicatedStateTagsContainer, this);
+		GetReplicatedContainer(Tag).OverrideStack(Tag, NewCount);
+		MarkReplicatedContainerDirty(Tag);
 	}
 }
 
@@ -252,6 +640,23 @@ void UGameplayTagManager::ChangeTags(FGameplayTagContainer Tags, bool bAdd)
 	}
 }
 
+void UGameplayTagManager::SetCustomReplicationChannelActive(bool bActive)
+{
+	if (!ensureMsgf(GetOwner()->HasAuthority(), TEXT("Replication channels must be changed server-side only")))
+	{
+		return;
+	}
+
+	if (!IsContainerInUse(EGTM_StackContainerId::Custom))
+	{
+		return;
+	}
+
+	FlushOwnerNetDormancy();
+
+	DOREPCUSTOMCONDITION_SETACTIVE_FAST(ThisClass, CustomStateTagsContainer, bActive);
+}
+
 FGameplayTagContainer UGameplayTagManager::GetLooseTags() const
 {
 	return LooseStateTagsContainer.GetTags();
@@ -356,6 +761,14 @@ void UGameplayTagManager::AddAuthoritativeTag(FGameplayTag Tag)
 		return;
 	}
 
+	if (ShouldPredictAuthoritativeTags())
+	{
+		PredictAuthoritativeTag(Tag, EGTM_TagMutationType::Add, 1);
+		return;
+	}
+
+	FlushOwnerNetDormancy();
+
 	AuthoritativeStateTagsContainer.AddStack(Tag, 1);
 	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, AuthoritativeStateTagsContainer, this);
 }
@@ -377,6 +790,14 @@ void UGameplayTagManager::RemoveAuthoritativeTag(FGameplayTag Tag)
 		return;
 	}
 
+	if (ShouldPredictAuthoritativeTags())
+	{
+		PredictAuthoritativeTag(Tag, EGTM_TagMutationType::Remove, 1);
+		return;
+	}
+
+	FlushOwnerNetDormancy();
+
 	AuthoritativeStateTagsContainer.RemoveStack(Tag, 1);
 	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, AuthoritativeStateTagsContainer, this);
 }
@@ -392,6 +813,14 @@ void UGameplayTagManager::RemoveAuthoritativeTags(FGameplayTagContainer Tags)
 
 void UGameplayTagManager::OverrideAuthoritativeTag(FGameplayTag Tag, int32 NewCount)
 {
+	if (ShouldPredictAuthoritativeTags())
+	{
+		PredictAuthoritativeTag(Tag, EGTM_TagMutationType::Override, NewCount);
+		return;
+	}
+
+	FlushOwnerNetDormancy();
+
 	AuthoritativeStateTagsContainer.OverrideStack(Tag, NewCount);
 	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, AuthoritativeStateTagsContainer, this);
 }
@@ -407,12 +836,12 @@ void UGameplayTagManager::OverrideAuthoritativeTags(FGameplayTagContainer Tags,
 
 void UGameplayTagManager::ClearAuthoritativeTag(FGameplayTag Tag)
 {
-	OverrideLooseTag(Tag, 0);
+	OverrideAuthoritativeTag(Tag, 0);
 }
 
 void UGameplayTagManager::ClearAuthoritativeTags(FGameplayTagContainer Tags)
 {
-	OverrideLooseTags(Tags, 0);
+	OverrideAuthoritativeTags(Tags, 0);
 }
 
 void UGameplayTagManager::ChangeAuthoritativeTag(FGameplayTag Tag, bool bAdd)
@@ -439,21 +868,508 @@ void UGameplayTagManager::ChangeAuthoritativeTags(FGameplayTagContainer Tags, bo
 	}
 }
 
+FGTM_TagContributionHandle UGameplayTagManager::AddTagContribution(FGameplayTag Tag, const UObject* Source,
+	EGTM_TagContainerType ContainerType, int32 Count)
+{
+	if (!ensureMsgf(IsValid(Source), TEXT("A contribution needs a valid source")))
+	{
+		return FGTM_TagContributionHandle();
+	}
+
+	EGTM_StackContainerId ContainerId = EGTM_StackContainerId::Loose;
+	switch (ContainerType)
+	{
+		case EGTM_TagContainerType::Replicated:
+			if (!ensureMsgf(GetOwner()->HasAuthority(), TEXT("Replicated tags must be changed server-side only")))
+			{
+				return FGTM_TagContributionHandle();
+			}
+
+			ContainerId = GetReplicatedContainerId(Tag);
+			break;
+		case EGTM_TagContainerType::Authoritative:
+			if (!ensureMsgf(GetOwner()->GetLocalRole() != ROLE_SimulatedProxy,
+				TEXT("Authoritative tags can be changed only by server or autonomous proxy")))
+			{
+				return FGTM_TagContributionHandle();
+			}
+
+			if (!ensureMsgf(!ShouldPredictAuthoritativeTags(),
+				TEXT("Contributions to predicted authoritative tags aren't supported")))
+			{
+				return FGTM_TagContributionHandle();
+			}
+
+			ContainerId = EGTM_StackContainerId::Authoritative;
+			break;
+		default:
+			break;
+	}
+
+	if (ContainerId != EGTM_StackContainerId::Loose)
+	{
+		FlushOwnerNetDormancy();
+	}
+
+	const FGTM_TagContributionHandle Handle = GetContainer(ContainerId).AddContribution(Tag, Count, Source);
+	MarkContainerDirty(ContainerId);
+	return Handle;
+}
+
+bool UGameplayTagManager::RemoveTagContribution(FGTM_TagContributionHandle Handle)
+{
+	if (!Handle.IsValid() || Handle.ContainerId >= EGTM_StackContainerId::Num)
+	{
+		return false;
+	}
+
+	// Only contributions added with authority can be in the replicated containers, so no need to check it again
+	if (Handle.ContainerId != EGTM_StackContainerId::Loose)
+	{
+		FlushOwnerNetDormancy();
+	}
+
+	if (!GetContainer(Handle.ContainerId).RemoveContribution(Handle))
+	{
+		return false;
+	}
+
+	MarkContainerDirty(Handle.ContainerId);
+	return true;
+}
+
+void UGameplayTagManager::RemoveTagContributions(const UObject* Source)
+{
+	// A source may contribute many tags; listeners are notified once, after all of them are removed
+	++NotificationBatchDepth;
+
+	const FObjectKey SourceKey(Source);
+	for (int32 Index = 0; Index < static_cast<int32>(EGTM_StackContainerId::Num); ++Index)
+	{
+		const auto ContainerId = static_cast<EGTM_StackContainerId>(Index);
+		FGTM_GameplayTagStackContainer& Container = GetContainer(ContainerId);
+		if (!Container.HasContributions(SourceKey))
+		{
+			continue;
+		}
+
+		if (ContainerId != EGTM_StackContainerId::Loose)
+		{
+			FlushOwnerNetDormancy();
+		}
+
+		Container.RemoveContributions(SourceKey);
+		MarkContainerDirty(ContainerId);
+	}
+
+	--NotificationBatchDepth;
+
+	if (NotificationBatchDepth == 0 && bHasPendingNotification)
+	{
+		bHasPendingNotification = false;
+		NotifyTagsChanged();
+	}
+}
+
+int32 UGameplayTagManager::GetTagContributionCount(FGameplayTag Tag, const UObject* Source) const
+{
+	const FObjectKey SourceKey(Source);
+
+	int32 Count = 0;
+	for (int32 Index = 0; Index < static_cast<int32>(EGTM_StackContainerId::Num); ++Index)
+	{
+		Count += GetContainer(static_cast<EGTM_StackContainerId>(Index)).GetContributedStackCount(SourceKey, Tag);
+	}
+
+	return Count;
+}
+
+bool UGameplayTagManager::ShouldPredictAuthoritativeTags() const
+{
+	return bPredictAuthoritativeTags && GetOwnerRole() == ROLE_AutonomousProxy;
+}
+
+void UGameplayTagManager::PredictAuthoritativeTag(FGameplayTag Tag, EGTM_TagMutationType Mutation, int32 Count)
+{
+	check(IsInGameThread());
+
+	const int32 OldCount = AuthoritativeStateTagsContainer.GetStackCount(Tag);
+	ApplyTagMutation(AuthoritativeStateTagsContainer, Tag, Mutation, Count);
+	const int32 Delta = AuthoritativeStateTagsContainer.GetStackCount(Tag) - OldCount;
+
+	// Send the change even if nothing changed locally, the server state might differ
+	const uint16 PredictionKey = PredictionHistory.Record(Tag, Delta);
+	ServerPredictAuthoritativeTag(PredictionKey, Tag, Mutation, Count);
+}
+
+void UGameplayTagManager::ServerPredictAuthoritativeTag_Implementation(uint16 PredictionKey, FGameplayTag Tag,
+	EGTM_TagMutationType Mutation, int32 Count)
+{
+	const bool bIsValidCount = Mutation == EGTM_TagMutationType::Override ? Count >= 0 : Count > 0;
+	const bool bAccepted = Tag.IsValid() && bIsValidCount &&
+		(!ValidatePredictedTagDelegate.IsBound() || ValidatePredictedTagDelegate.Execute(this, Tag, Mutation, Count));
+
+	if (!bAccepted)
+	{
+		ClientRejectPredictedTag(PredictionKey);
+		return;
+	}
+
+	FlushOwnerNetDormancy();
+
+	ApplyTagMutation(AuthoritativeStateTagsContainer, Tag, Mutation, Count);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, AuthoritativeStateTagsContainer, this);
+
+	ClientConfirmPredictedTag(PredictionKey);
+}
+
+void UGameplayTagManager::ClientConfirmPredictedTag_Implementation(uint16 PredictionKey)
+{
+	FGTM_TagPredictionHistory::FEntry Entry;
+	PredictionHistory.Consume(PredictionKey, Entry);
+}
+
+void UGameplayTagManager::ClientRejectPredictedTag_Implementation(uint16 PredictionKey)
+{
+	FGTM_TagPredictionHistory::FEntry Entry;
+	if (!PredictionHistory.Consume(PredictionKey, Entry) || Entry.Delta == 0)
+	{
+		return;
+	}
+
+	// Undo only this prediction's share so that later predictions of the same tag stay applied
+	const int32 CurrentCount = AuthoritativeStateTagsContainer.GetStackCount(Entry.Tag);
+	AuthoritativeStateTagsContainer.OverrideStack(Entry.Tag, FMath::Max(CurrentCount - Entry.Delta, 0));
+}
+
+void UGameplayTagManager::ApplyTagOperationsImpl(TConstArrayView<FGTM_TagOperation> Operations)
+{
+	++NotificationBatchDepth;
+
+	// Profiling records are handed over once per batch, rather than taking their locks on every mutation
+	GTM_JOURNAL_BATCH_SCOPE();
+	GTM_TAG_CHURN_BATCH_SCOPE();
+
+	const bool bHasAuthority = GetOwnerRole() == ROLE_Authority;
+	const bool bIsNotSimProxy = GetOwnerRole() != ROLE_SimulatedProxy;
+	for (const FGTM_TagOperation& Operation : Operations)
+	{
+		EGTM_StackContainerId ContainerId = EGTM_StackContainerId::Loose;
+		switch (Operation.Container)
+		{
+			case EGTM_TagContainerType::Replicated:
+				if (!ensureMsgf(bHasAuthority, TEXT("Replicated tags must be changed server-side only")))
+				{
+					continue;
+				}
+
+				ContainerId = GetReplicatedContainerId(Operation.Tag);
+				break;
+			case EGTM_TagContainerType::Authoritative:
+				if (!ensureMsgf(bIsNotSimProxy,
+					TEXT("Authoritative tags can be changed only by server or autonomous proxy")))
+				{
+					continue;
+				}
+
+				if (ShouldPredictAuthoritativeTags())
+				{
+					PredictAuthoritativeTag(Operation.Tag, Operation.Mutation, Operation.Count);
+					continue;
+				}
+
+				ContainerId = EGTM_StackContainerId::Authoritative;
+				break;
+			default:
+				break;
+		}
+
+		ApplyTagMutation(GetContainer(ContainerId), Operation.Tag, Operation.Mutation, Operation.Count);
+		PendingDirtyContainers |= 1 << static_cast<uint8>(ContainerId);
+	}
+
+	// The notification is left pending; it drives listeners, debuggers and property maps that need the game thread
+	--NotificationBatchDepth;
+}
+
+void UGameplayTagManager::FlushPendingChanges()
+{
+	check(IsInGameThread());
+
+	MarkPendingContainersDirty();
+
+	if (NotificationBatchDepth == 0 && bHasPendingNotification)
+	{
+		bHasPendingNotification = false;
+		NotifyTagsChanged();
+	}
+}
+
+void UGameplayTagManager::MarkPendingContainersDirty()
+{
+	check(IsInGameThread());
+
+	// Loose tags never replicate
+	PendingDirtyContainers &= ~(1 << static_cast<uint8>(EGTM_StackContainerId::Loose));
+	if (PendingDirtyContainers == 0)
+	{
+		return;
+	}
+
+	FlushOwnerNetDormancy();
+
+	for (uint8 Index = 0; Index < static_cast<uint8>(EGTM_StackContainerId::Num); ++Index)
+	{
+		if (PendingDirtyContainers & (1 << Index))
+		{
+			MarkContainerDirty(static_cast<EGTM_StackContainerId>(Index));
+		}
+	}
+
+	PendingDirtyContainers = 0;
+}
+
+EGTM_StackContainerId UGameplayTagManager::GetReplicatedContainerId(FGameplayTag Tag) const
+{
+	switch (UGTM_GameplayTagManagerSettings::Get()->GetReplicationChannel(Tag))
+	{
+		case EGTM_ReplicationChannel::OwnerOnly:
+			return EGTM_StackContainerId::OwnerOnly;
+		case EGTM_ReplicationChannel::Custom:
+			return EGTM_StackContainerId::Custom;
+		default:
+			return EGTM_StackContainerId::Replicated;
+	}
+}
+
+bool UGameplayTagManager::IsContainerInUse(EGTM_StackContainerId ContainerId) const
+{
+	switch (ContainerId)
+	{
+		case EGTM_StackContainerId::OwnerOnly:
+			return UGTM_GameplayTagManagerSettings::Get()->IsChannelRouted(EGTM_ReplicationChannel::OwnerOnly);
+		case EGTM_StackContainerId::Custom:
+			return UGTM_GameplayTagManagerSettings::Get()->IsChannelRouted(EGTM_ReplicationChannel::Custom);
+		default:
+			return true;
+	}
+}
+
+FGTM_GameplayTagStackContainer& UGameplayTagManager::GetContainer(EGTM_StackContainerId ContainerId)
+{
+	const auto& ConstThis = *this;
+	return const_cast<FGTM_GameplayTagStackContainer&>(ConstThis.GetContainer(ContainerId));
+}
+
+const FGTM_GameplayTagStackContainer& UGameplayTagManager::GetContainer(EGTM_StackContainerId ContainerId) const
+{
+	switch (ContainerId)
+	{
+		case EGTM_StackContainerId::OwnerOnly:
+			return OwnerOnlyStateTagsContainer;
+		case EGTM_StackContainerId::Custom:
+			return CustomStateTagsContainer;
+		case EGTM_StackContainerId::Loose:
+			return LooseStateTagsContainer;
+		case EGTM_StackContainerId::Authoritative:
+			return AuthoritativeStateTagsContainer;
+		default:
+			return ReplicatedStateTagsContainer;
+	}
+}
+
+FGTM_GameplayTagStackContainer& UGameplayTagManager::GetReplicatedContainer(FGameplayTag Tag)
+{
+	return GetContainer(GetReplicatedContainerId(Tag));
+}
+
+const FGTM_GameplayTagStackContainer& UGameplayTagManager::GetReplicatedContainer(FGameplayTag Tag) const
+{
+	return GetContainer(GetReplicatedContainerId(Tag));
+}
+
+void UGameplayTagManager::MarkContainerDirty(EGTM_StackContainerId ContainerId)
+{
+	switch (ContainerId)
+	{
+		case EGTM_StackContainerId::Replicated:
+			MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ReplicatedStateTagsContainer, this);
+			break;
+		case EGTM_StackContainerId::OwnerOnly:
+			MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, OwnerOnlyStateTagsContainer, this);
+			break;
+		case EGTM_StackContainerId::Custom:
+			MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, CustomStateTagsContainer, this);
+			break;
+		case EGTM_StackContainerId::Authoritative:
+			MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, AuthoritativeStateTagsContainer, this);
+			break;
+		default:
+			break;
+	}
+}
+
+void UGameplayTagManager::MarkReplicatedContainerDirty(FGameplayTag Tag)
+{
+	MarkContainerDirty(GetReplicatedContainerId(Tag));
+}
+
+void UGameplayTagManager::FlushOwnerNetDormancy()
+{
+	if (!bDriveOwnerNetDormancy || GetOwnerRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	AActor* Owner = GetOwner();
+	if (Owner->NetDormancy > DORM_Awake)
+	{
+		Owner->FlushNetDormancy();
+	}
+
+	LastReplicatedTagsChangeTime = GetWorld()->GetTimeSeconds();
+
+	// Avoid resetting the timer on every change; the timer reschedules itself for the remaining idle time instead
+	if (!GetWorld()->GetTimerManager().IsTimerActive(NetDormancyTimerHandle))
+	{
+		ScheduleOwnerNetDormancy(NetDormancyIdleTime);
+	}
+}
+
+void UGameplayTagManager::ScheduleOwnerNetDormancy(float Delay)
+{
+	GetWorld()->GetTimerManager().SetTimer(NetDormancyTimerHandle, this, &ThisClass::OnNetDormancyIdleTimeElapsed,
+		FMath::Max(Delay, UE_KINDA_SMALL_NUMBER), false);
+}
+
+void UGameplayTagManager::OnNetDormancyIdleTimeElapsed()
+{
+	AActor* Owner = GetOwner();
+	if (!IsValid(Owner) || Owner->NetDormancy == DORM_Never)
+	{
+		return;
+	}
+
+	const double IdleTime = GetWorld()->GetTimeSeconds() - LastReplicatedTagsChangeTime;
+	if (IdleTime < NetDormancyIdleTime)
+	{
+		ScheduleOwnerNetDormancy(NetDormancyIdleTime - IdleTime);
+		return;
+	}
+
+	Owner->SetNetDormancy(DORM_DormantAll);
+}
+
+UGameplayTagManager::FListenerTables& UGameplayTagManager::GetOrCreateListenerTables()
+{
+	if (!ListenerTables)
+	{
+		ListenerTables = MakeUnique<FListenerTables>();
+	}
+
+	return *ListenerTables;
+}
+
+void UGameplayTagManager::OnStackCountChanged(FGameplayTag Tag, int32 OldCount, int32 NewCount)
+{
+	if (!HasCountListeners())
+	{
+		return;
+	}
+
+	// Containers only know their own stacks; the manager-wide count is offset by what the other containers hold.
+	// CachedTagsCount is only rebuilt when notifying, so it still holds the count the listeners last saw
+	FPendingCountChange* Change = PendingCountChanges.FindByPredicate([Tag](const FPendingCountChange& Pending)
+	{
+		return Pending.Tag == Tag;
+	});
+
+	if (!Change)
+	{
+		const int32 CachedCount = CachedTagsCount.FindRef(Tag);
+		Change = &PendingCountChanges.Add_GetRef({ Tag, CachedCount, CachedCount });
+	}
+
+	Change->NewCount += NewCount - OldCount;
+}
+
+bool UGameplayTagManager::HasCountListeners() const
+{
+	return OnTagCountChangedSimpleDelegate.IsBound() || (ListenerTables && !ListenerTables->CountListeners.IsEmpty());
+}
+
 void UGameplayTagManager::NotifyTagsChanged()
 {
+	if (NotificationBatchDepth > 0)
+	{
+		bHasPendingNotification = true;
+		return;
+	}
+
 	SCOPE_CYCLE_COUNTER(STAT_GTM_BroadcastingTags);
+	INC_DWORD_STAT(STAT_GTM_Notifications);
+
+	if (const UWorld* World = GetWorld())
+	{
+		LastTagChangeTime = World->GetTimeSeconds();
+	}
 
 	CacheTags();
 
+	// Taken before broadcasting, as listeners may change the tags again and gather new changes
+	const TArray<FPendingCountChange> CountChanges = MoveTemp(PendingCountChanges);
+	PendingCountChanges.Reset();
+
+	for (const FPendingCountChange& Change : CountChanges)
+	{
+		if (Change.OldCount == Change.NewCount)
+		{
+			continue;
+		}
+
+		OnTagCountChangedSimpleDelegate.Broadcast(this, Change.Tag, Change.OldCount, Change.NewCount);
+
+		const FOnTagCountChangedSimpleSignature* Listeners = ListenerTables
+			? ListenerTables->CountListeners.Find(Change.Tag)
+			: nullptr;
+		if (Listeners)
+		{
+			// Copied as the listeners may bind others and reallocate the table
+			const FOnTagCountChangedSimpleSignature ListenersCopy = *Listeners;
+			INC_DWORD_STAT(STAT_GTM_ListenerInvocations);
+			ListenersCopy.Broadcast(this, Change.Tag, Change.OldCount, Change.NewCount);
+		}
+	}
+
 	const FGameplayTagContainer Tags = GetTags();
 	const FGameplayTagContainer AddedTags = ::RemoveTags(Tags, LastKnownTags);
 	const FGameplayTagContainer RemovedTags = ::RemoveTags(LastKnownTags, Tags);
 
 	LastKnownTags = Tags;
 
+	INC_DWORD_STAT_BY(STAT_GTM_DiffSize, AddedTags.Num() + RemovedTags.Num());
+
+	// Recorded regardless of listeners, so managers nobody listens to still show up in the churn stats
+	for (const FGameplayTag& Tag : AddedTags)
+	{
+		GTM_RECORD_TAG_CHURN(Notification, this, Tag);
+	}
+
+	for (const FGameplayTag& Tag : RemovedTags)
+	{
+		GTM_RECORD_TAG_CHURN(Notification, this, Tag);
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_GTM_InvokingListeners);
+
 	OnTagsChangeSimpleDelegate.Broadcast(this, AddedTags, RemovedTags);
 	OnTagsChangedDelegate.Broadcast(this, AddedTags, RemovedTags);
 
+	if (!ListenerTables)
+	{
+		return;
+	}
+
 	FGameplayTagContainer ModifiedTags;
 	ModifiedTags.AppendTags(AddedTags);
 	ModifiedTags.AppendTags(RemovedTags);
@@ -461,20 +1377,24 @@ void UGameplayTagManager::NotifyTagsChanged()
 	const TArray<FGameplayTag>& ModifiedTagsArray = ModifiedTags.GetGameplayTagArray();
 	for (const FGameplayTag& It : ModifiedTagsArray)
 	{
-		const auto SingleListenersCopy = SingleListeners;
+		const auto SingleListenersCopy = ListenerTables->SingleListeners;
 		for (auto& [Tag, Listeners] : SingleListenersCopy)
 		{
 			if (It.MatchesTag(Tag))
 			{
+				INC_DWORD_STAT(STAT_GTM_ListenerInvocations);
+				GTM_RECORD_TAG_CHURN(ListenerCall, this, It);
 				Listeners.Broadcast(this, It, Tags.HasTagExact(It));
 			}
 		}
 
-		const auto SingleSimpleListenersCopy = SingleSimpleListeners;
+		const auto SingleSimpleListenersCopy = ListenerTables->SingleSimpleListeners;
 		for (auto& [Tag, Listeners] : SingleSimpleListenersCopy)
 		{
 			if (It.MatchesTag(Tag))
 			{
+				INC_DWORD_STAT(STAT_GTM_ListenerInvocations);
+				GTM_RECORD_TAG_CHURN(ListenerCall, this, It);
 				Listeners.Broadcast(this, It, Tags.HasTagExact(It));
 			}
 		}
@@ -483,16 +1403,18 @@ void UGameplayTagManager::NotifyTagsChanged()
 
 void UGameplayTagManager::CacheTags()
 {
+	SCOPE_CYCLE_COUNTER(STAT_GTM_CachingTags);
+	INC_DWORD_STAT(STAT_GTM_CacheRebuilds);
+
 	CachedTagsCount.Reset();
 	CachedTags.Reset();
 
-	CachedTagsCount.Append(ReplicatedStateTagsContainer.GetTagToCountMap());
-	CachedTagsCount.Append(LooseStateTagsContainer.GetTagToCountMap());
-	CachedTagsCount.Append(AuthoritativeStateTagsContainer.GetTagToCountMap());
-
-	CachedTags.AppendTags(ReplicatedStateTagsContainer.GetTags());
-	CachedTags.AppendTags(LooseStateTagsContainer.GetTags());
-	CachedTags.AppendTags(AuthoritativeStateTagsContainer.GetTags());
+	for (int32 Index = 0; Index < static_cast<int32>(EGTM_StackContainerId::Num); ++Index)
+	{
+		const FGTM_GameplayTagStackContainer& Container = GetContainer(static_cast<EGTM_StackContainerId>(Index));
+		Container.AppendTagCounts(CachedTagsCount);
+		Container.AppendTags(CachedTags);
+	}
 }
 
 #if ENABLE_DRAW_DEBUG
@@ -509,6 +1431,6 @@ void UGameplayTagManager::ShowDebugInfo(AHUD* HUD, UCanvas* Canvas, const FDebug
 	const FShowDebugContext Context(HUD, Canvas, DisplayInfo);
 	FShowDebugIntermediate IntermediateData(YL, YPos);
 
-	ShowDebugObj.ShowDebugInfo(Context, IntermediateData);
+	FGTM_ShowDebug::ShowDebugInfo(Context, IntermediateData);
 }
 #endif
@@ -5,6 +5,7 @@
 #include "GameplayDebugger.h"
 #include "Debug/GameplayDebuggerCategory_GameplayTags.h"
 #include "Engine/Console.h"
+#include "Profiling/GTM_TagJournal.h"
 
 const static FName DebuggerCategoryName = "Gameplay Tags";
 
@@ -30,10 +31,26 @@ void FGameplayTagManagerModule::StartupModule()
 		AutoCompleteCommand.Desc = TEXT("Toggles debug information for Gameplay Tag Manager");
 		AutoCompleteCommand.Color = ConsoleSettings->AutoCompleteCommandColor;
 	});
+
+#if GTM_TAG_JOURNAL_ENABLED
+	FString JournalPath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("GTMJournal="), JournalPath))
+	{
+		GameplayTagManager::TagJournal::Start(JournalPath);
+	}
+	else if (FParse::Param(FCommandLine::Get(), TEXT("GTMJournal")))
+	{
+		GameplayTagManager::TagJournal::Start();
+	}
+#endif
 }
 
 void FGameplayTagManagerModule::ShutdownModule()
 {
+#if GTM_TAG_JOURNAL_ENABLED
+	GameplayTagManager::TagJournal::Stop();
+#endif
+
 #if WITH_GAMEPLAY_DEBUGGER
 	IGameplayDebugger& GameplayDebuggerModule = IGameplayDebugger::Get();
 	GameplayDebuggerModule.UnregisterCategory(DebuggerCategoryName);
@@ -7,3 +7,18 @@ DECLARE_CYCLE_STAT(TEXT("Adding Tags"), STAT_GTM_AddingTags, STATGROUP_GTM);
 DECLARE_CYCLE_STAT(TEXT("Removing Tags"), STAT_GTM_RemovingTags, STATGROUP_GTM);
 DECLARE_CYCLE_STAT(TEXT("Overriding Tags"), STAT_GTM_OverridingTags, STATGROUP_GTM);
 DECLARE_CYCLE_STAT(TEXT("Broadcasting Tags"), STAT_GTM_BroadcastingTags, STATGROUP_GTM);
+DECLARE_CYCLE_STAT(TEXT("Bulk Operations"), STAT_GTM_BulkOperations, STATGROUP_GTM);
+DECLARE_CYCLE_STAT(TEXT("Caching Tags"), STAT_GTM_CachingTags, STATGROUP_GTM);
+DECLARE_CYCLE_STAT(TEXT("Invoking Listeners"), STAT_GTM_InvokingListeners, STATGROUP_GTM);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Notifications"), STAT_GTM_Notifications, STATGROUP_GTM);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Cache Rebuilds"), STAT_GTM_CacheRebuilds, STATGROUP_GTM);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Listener Invocations"), STAT_GTM_ListenerInvocations, STATGROUP_GTM);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Notified Tags Diff Size"), STAT_GTM_DiffSize, STATGROUP_GTM);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queries"), STAT_GTM_Queries, STATGROUP_GTM);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Replicated Bytes (Replicated)"), STAT_GTM_ReplicatedBytes_Replicated, STATGROUP_GTM);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Replicated Bytes (Owner Only)"), STAT_GTM_ReplicatedBytes_OwnerOnly, STATGROUP_GTM);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Replicated Bytes (Custom)"), STAT_GTM_ReplicatedBytes_Custom, STATGROUP_GTM);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Replicated Bytes (Authoritative)"), STAT_GTM_ReplicatedBytes_Authoritative,
+	STATGROUP_GTM);
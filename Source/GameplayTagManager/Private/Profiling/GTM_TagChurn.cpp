@@ -0,0 +1,253 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Profiling/GTM_TagChurn.h"
+
+#if GTM_TAG_CHURN_ENABLED
+#include "Components/ActorComponent.h"
+#include "Containers/Ticker.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+namespace GameplayTagManager::TagChurn
+{
+	std::atomic<bool> bIsRecording = false;
+}
+
+namespace
+{
+	using namespace GameplayTagManager::TagChurn;
+
+	constexpr int32 NumEvents = static_cast<int32>(EEvent::Num);
+
+	struct FChurnCounts
+	{
+	public:
+		uint64 GetTotal() const
+		{
+			uint64 Total = 0;
+			for (const uint64 Count : Events)
+			{
+				Total += Count;
+			}
+
+			return Total;
+		}
+
+		FChurnCounts& operator+=(const FChurnCounts& Other)
+		{
+			for (int32 Index = 0; Index < NumEvents; ++Index)
+			{
+				Events[Index] += Other.Events[Index];
+			}
+
+			return *this;
+		}
+
+	public:
+		uint64 Events[NumEvents] = { };
+	};
+
+	using FChurnKey = TPair<FGameplayTag, FName>;
+
+	int32 GSampleRate = 1;
+	FAutoConsoleVariableRef CVarSampleRate(
+		TEXT("gtm.TopTags.SampleRate"),
+		GSampleRate,
+		TEXT("Records one out of this many events while gtm.TopTags is running. Counts are scaled back up."));
+
+	FCriticalSection ChurnLock;
+	TMap<FChurnKey, FChurnCounts> ChurnCounts;
+
+	/** Events held back by the FScopedRecordBatch of this thread, with the weight they're counted with. */
+	struct FBatchedEvent
+	{
+	public:
+		FChurnKey Key;
+		EEvent Event = EEvent::Mutation;
+		int32 Weight = 0;
+	};
+
+	thread_local int32 GBatchDepth = 0;
+	thread_local TArray<FBatchedEvent> GBatchedEvents;
+	double RecordingStartTime = 0.0;
+	double RecordingStopTime = 0.0;
+	FTSTicker::FDelegateHandle StopTickerHandle;
+
+	template<typename KeyType>
+	void PrintTop(FOutputDevice& Ar, const TCHAR* Title, const TMap<KeyType, FChurnCounts>& Counts, int32 NumRows,
+		double Seconds, TFunctionRef<FString(const KeyType&)> KeyToString)
+	{
+		TArray<TPair<KeyType, FChurnCounts>> SortedCounts = Counts.Array();
+		SortedCounts.Sort([](const TPair<KeyType, FChurnCounts>& Lhs, const TPair<KeyType, FChurnCounts>& Rhs)
+		{
+			return Lhs.Value.GetTotal() > Rhs.Value.GetTotal();
+		});
+
+		Ar.Logf(TEXT("%s"), Title);
+		Ar.Logf(TEXT("  %12s %12s %12s %10s  %s"), TEXT("Mutations"), TEXT("Notified"), TEXT("Listeners"),
+			TEXT("Total/s"), TEXT("Name"));
+
+		for (int32 Index = 0; Index < FMath::Min(NumRows, SortedCounts.Num()); ++Index)
+		{
+			const auto& [Key, Value] = SortedCounts[Index];
+			Ar.Logf(TEXT("  %12llu %12llu %12llu %10.1f  %s"),
+				Value.Events[static_cast<int32>(EEvent::Mutation)],
+				Value.Events[static_cast<int32>(EEvent::Notification)],
+				Value.Events[static_cast<int32>(EEvent::ListenerCall)],
+				Seconds > 0.0 ? Value.GetTotal() / Seconds : 0.0,
+				*KeyToString(Key));
+		}
+	}
+
+	void PrintReport(FOutputDevice& Ar, int32 NumRows)
+	{
+		TMap<FChurnKey, FChurnCounts> CountsCopy;
+		{
+			FScopeLock Lock(&ChurnLock);
+			CountsCopy = ChurnCounts;
+		}
+
+		TMap<FGameplayTag, FChurnCounts> TagCounts;
+		TMap<FName, FChurnCounts> ClassCounts;
+		for (const auto& [Key, Counts] : CountsCopy)
+		{
+			TagCounts.FindOrAdd(Key.Key) += Counts;
+			ClassCounts.FindOrAdd(Key.Value) += Counts;
+		}
+
+		const double EndTime = bIsRecording ? FPlatformTime::Seconds() : RecordingStopTime;
+		const double Seconds = FMath::Max(EndTime - RecordingStartTime, 0.0);
+		Ar.Logf(TEXT("Gameplay tag churn over %.2f seconds (sample rate 1/%d)%s"), Seconds, FMath::Max(GSampleRate, 1),
+			bIsRecording ? TEXT(", still recording") : TEXT(""));
+
+		PrintTop<FGameplayTag>(Ar, TEXT("Top tags:"), TagCounts, NumRows, Seconds,
+			[](const FGameplayTag& Tag) { return Tag.ToString(); });
+		PrintTop<FName>(Ar, TEXT("Top owner classes:"), ClassCounts, NumRows, Seconds,
+			[](const FName& ClassName) { return ClassName.ToString(); });
+		PrintTop<FChurnKey>(Ar, TEXT("Top tags per owner class:"), CountsCopy, NumRows, Seconds,
+			[](const FChurnKey& Key) { return FString::Printf(TEXT("%s on %s"), *Key.Key.ToString(),
+				*Key.Value.ToString()); });
+	}
+
+	void StopRecording()
+	{
+		bIsRecording = false;
+		RecordingStopTime = FPlatformTime::Seconds();
+
+		if (StopTickerHandle.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(StopTickerHandle);
+			StopTickerHandle.Reset();
+		}
+	}
+
+	void StartRecording(float Duration)
+	{
+		StopRecording();
+
+		{
+			FScopeLock Lock(&ChurnLock);
+			ChurnCounts.Reset();
+		}
+
+		RecordingStartTime = FPlatformTime::Seconds();
+		bIsRecording = true;
+
+		if (Duration > 0.f)
+		{
+			StopTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+			{
+				StopTickerHandle.Reset();
+				StopRecording();
+				PrintReport(*GLog, 20);
+				return false;
+			}), Duration);
+		}
+	}
+
+	void HandleTopTagsCommand(const TArray<FString>& Args, FOutputDevice& Ar)
+	{
+		const FString Action = Args.IsValidIndex(0) ? Args[0] : FString();
+		if (Action == TEXT("Start"))
+		{
+			const float Duration = Args.IsValidIndex(1) ? FCString::Atof(*Args[1]) : 10.f;
+			StartRecording(Duration);
+			Ar.Logf(TEXT("Recording gameplay tag churn%s"),
+				Duration > 0.f ? *FString::Printf(TEXT(" for %.2f seconds"), Duration) : TEXT(" until stopped"));
+		}
+		else if (Action == TEXT("Stop"))
+		{
+			StopRecording();
+			PrintReport(Ar, Args.IsValidIndex(1) ? FCString::Atoi(*Args[1]) : 20);
+		}
+		else
+		{
+			PrintReport(Ar, Action.IsNumeric() ? FCString::Atoi(*Action) : 20);
+		}
+	}
+
+	FAutoConsoleCommandWithArgsAndOutputDevice TopTagsCommand(
+		TEXT("gtm.TopTags"),
+		TEXT("Reports the tags and owner classes causing the most tag mutations, notifications and listener calls. "
+			"'Start [Seconds]' records for the given time (0 until stopped) and prints the report, 'Stop [Rows]' "
+			"stops and prints, '[Rows]' prints what was recorded so far."),
+		FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateStatic(&HandleTopTagsCommand));
+}
+
+namespace GameplayTagManager::TagChurn
+{
+	void Record(EEvent Event, const UObject* Manager, FGameplayTag Tag)
+	{
+		const int32 SampleRate = FMath::Max(GSampleRate, 1);
+		if (SampleRate > 1)
+		{
+			thread_local uint32 SampleCounter = 0;
+			if (++SampleCounter % SampleRate != 0)
+			{
+				return;
+			}
+		}
+
+		const auto* Component = Cast<UActorComponent>(Manager);
+		const AActor* Owner = Component ? Component->GetOwner() : nullptr;
+		const FName ClassName = Owner ? Owner->GetClass()->GetFName() : NAME_None;
+
+		if (GBatchDepth > 0)
+		{
+			GBatchedEvents.Add({ FChurnKey(Tag, ClassName), Event, SampleRate });
+			return;
+		}
+
+		FScopeLock Lock(&ChurnLock);
+		ChurnCounts.FindOrAdd(FChurnKey(Tag, ClassName)).Events[static_cast<int32>(Event)] += SampleRate;
+	}
+
+	FScopedRecordBatch::FScopedRecordBatch()
+	{
+		++GBatchDepth;
+	}
+
+	FScopedRecordBatch::~FScopedRecordBatch()
+	{
+		if (--GBatchDepth > 0 || GBatchedEvents.IsEmpty())
+		{
+			return;
+		}
+
+		// Events recorded after gtm.TopTags stopped are dropped, same as unbatched ones
+		if (bIsRecording.load(std::memory_order_relaxed))
+		{
+			FScopeLock Lock(&ChurnLock);
+			for (const FBatchedEvent& Batched : GBatchedEvents)
+			{
+				ChurnCounts.FindOrAdd(Batched.Key).Events[static_cast<int32>(Batched.Event)] += Batched.Weight;
+			}
+		}
+
+		// The allocation is kept for the next batch of this thread
+		GBatchedEvents.Reset();
+	}
+}
+#endif
@@ -0,0 +1,59 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+
+#if !defined(GTM_TAG_CHURN_ENABLED)
+#define GTM_TAG_CHURN_ENABLED !UE_BUILD_SHIPPING
+#endif
+
+#if GTM_TAG_CHURN_ENABLED
+#include <atomic>
+
+namespace GameplayTagManager::TagChurn
+{
+	enum class EEvent : uint8
+	{
+		Mutation,
+		Notification,
+		ListenerCall,
+		Num,
+	};
+
+	/** Set while gtm.TopTags is recording. Checked before anything else to keep the disabled cost to a single load. */
+	extern std::atomic<bool> bIsRecording;
+
+	/** Counts the event for the tag and the class of the manager's owner. Thread safe. */
+	void Record(EEvent Event, const UObject* Manager, FGameplayTag Tag);
+
+	/**
+	 * Holds back the events recorded on this thread while alive, and counts them all at once when the outermost scope
+	 * ends. Keeps worker threads applying many changes from contending on every one of them.
+	 */
+	class FScopedRecordBatch
+	{
+	public:
+		FScopedRecordBatch();
+		~FScopedRecordBatch();
+
+		UE_NONCOPYABLE(FScopedRecordBatch);
+	};
+}
+
+#define GTM_RECORD_TAG_CHURN(Event, Manager, Tag) \
+	do \
+	{ \
+		if (GameplayTagManager::TagChurn::bIsRecording.load(std::memory_order_relaxed)) \
+		{ \
+			GameplayTagManager::TagChurn::Record(GameplayTagManager::TagChurn::EEvent::Event, Manager, Tag); \
+		} \
+	} \
+	while (false)
+
+#define GTM_TAG_CHURN_BATCH_SCOPE() \
+	const GameplayTagManager::TagChurn::FScopedRecordBatch ANONYMOUS_VARIABLE(ChurnBatch)
+#else
+#define GTM_RECORD_TAG_CHURN(...)
+#define GTM_TAG_CHURN_BATCH_SCOPE()
+#endif
@@ -0,0 +1,324 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Profiling/GTM_TagJournal.h"
+
+#if GTM_TAG_JOURNAL_ENABLED
+#include "Debug/GTM_TagJournalReader.h"
+#include "GameplayTagsManager.h"
+#include "Gameplay/Misc/GameplayTagManager.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace GameplayTagManager::TagJournal
+{
+	std::atomic<bool> bIsRecording = false;
+}
+
+namespace
+{
+	using namespace GameplayTagManager::TagJournal;
+
+	int32 GMaxPendingKilobytes = 4096;
+	FAutoConsoleVariableRef CVarMaxPendingKilobytes(
+		TEXT("gtm.Journal.MaxPendingKB"),
+		GMaxPendingKilobytes,
+		TEXT("Memory the tag journal may hold before it's written. Records are dropped while it's full."));
+
+	float GFlushInterval = 0.25f;
+	FAutoConsoleVariableRef CVarFlushInterval(
+		TEXT("gtm.Journal.FlushInterval"),
+		GFlushInterval,
+		TEXT("Seconds between the tag journal writes."));
+
+	/** Change as passed to RecordTagChanged, stamped with when it happened. */
+	struct FPendingChange
+	{
+	public:
+		const UObject* Manager = nullptr;
+		FGameplayTag Tag;
+		EGTM_StackContainerId ContainerId = EGTM_StackContainerId::Loose;
+		int32 OldCount = 0;
+		int32 NewCount = 0;
+		uint64 Frame = 0;
+		double Seconds = 0.0;
+	};
+
+	/** Changes held back by the FScopedRecordBatch of this thread. */
+	thread_local int32 GBatchDepth = 0;
+	thread_local TArray<FPendingChange> GBatchedChanges;
+
+	/**
+	 * Owns the journal file. Game code appends records to a pending buffer, which the thread swaps out and writes.
+	 */
+	class FJournalWriter
+		: public FRunnable
+	{
+	public:
+		explicit FJournalWriter(IFileHandle* InFileHandle)
+			: FileHandle(InFileHandle)
+			, StartTime(FPlatformTime::Seconds())
+		{
+			WakeEvent = FPlatformProcess::GetSynchEventFromPool();
+			Thread = FRunnableThread::Create(this, TEXT("GTM_TagJournalWriter"), 0, TPri_BelowNormal);
+		}
+
+		virtual ~FJournalWriter() override
+		{
+			bStopRequested = true;
+			WakeEvent->Trigger();
+
+			if (Thread)
+			{
+				Thread->WaitForCompletion();
+				delete Thread;
+			}
+
+			FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		}
+
+		//~FRunnable Interface
+		virtual uint32 Run() override
+		{
+			while (!bStopRequested)
+			{
+				WakeEvent->Wait(FTimespan::FromSeconds(FMath::Max(GFlushInterval, 0.01f)));
+				Flush();
+			}
+
+			Flush();
+			return 0;
+		}
+		//~End of FRunnable Interface
+
+		void Record(TConstArrayView<FPendingChange> Changes)
+		{
+			FScopeLock Lock(&PendingLock);
+			for (const FPendingChange& Change : Changes)
+			{
+				RecordLocked(Change);
+			}
+		}
+
+	private:
+		void RecordLocked(const FPendingChange& Change)
+		{
+			const UObject* Manager = Change.Manager;
+			const FGameplayTag Tag = Change.Tag;
+
+			FTagChangedRecord Record;
+			Record.ManagerId = Manager ? Manager->GetUniqueID() : 0;
+			Record.TagNetIndex = UGameplayTagsManager::Get().GetNetIndexFromTag(Tag);
+			Record.ContainerId = static_cast<uint8>(Change.ContainerId);
+			Record.OldCount = Change.OldCount;
+			Record.NewCount = Change.NewCount;
+			Record.Frame = Change.Frame;
+			Record.Time = Change.Seconds - StartTime;
+
+			// Keep the memory bounded; the reader learns about the gap from a Dropped record
+			if (PendingBuffer.Num() >= GMaxPendingKilobytes * 1024)
+			{
+				NumDropped++;
+				return;
+			}
+
+			FMemoryWriter Writer(PendingBuffer, false, true);
+
+			// Names are only written the first time they're met
+			const TWeakObjectPtr<const UObject>* KnownManager = KnownManagers.Find(Record.ManagerId);
+			if (!KnownManager || KnownManager->Get() != Manager)
+			{
+				KnownManagers.Add(Record.ManagerId, Manager);
+
+				const auto* Component = Cast<UActorComponent>(Manager);
+				const AActor* Owner = Component ? Component->GetOwner() : nullptr;
+				FString Name = Owner ? Owner->GetPathName() : GetPathNameSafe(Manager);
+
+				ERecordType Type = ERecordType::ManagerName;
+				Writer << Type;
+				Writer << Record.ManagerId;
+				Writer << Name;
+			}
+
+			if (!KnownTags.IsValidIndex(Record.TagNetIndex) || !KnownTags[Record.TagNetIndex])
+			{
+				if (KnownTags.Num() <= Record.TagNetIndex)
+				{
+					KnownTags.Add(false, Record.TagNetIndex + 1 - KnownTags.Num());
+				}
+
+				KnownTags[Record.TagNetIndex] = true;
+
+				FString Name = Tag.ToString();
+				ERecordType Type = ERecordType::TagName;
+				Writer << Type;
+				Writer << Record.TagNetIndex;
+				Writer << Name;
+			}
+
+			ERecordType Type = ERecordType::TagChanged;
+			Writer << Type;
+			Record.Serialize(Writer);
+		}
+
+		void Flush()
+		{
+			{
+				FScopeLock Lock(&PendingLock);
+
+				// Written here rather than with the next record, so a gap right before the journal stops isn't lost
+				if (NumDropped > 0)
+				{
+					FMemoryWriter Writer(PendingBuffer, false, true);
+					ERecordType Type = ERecordType::Dropped;
+					Writer << Type;
+					Writer << NumDropped;
+					NumDropped = 0;
+				}
+
+				Swap(PendingBuffer, WriteBuffer);
+			}
+
+			if (!WriteBuffer.IsEmpty())
+			{
+				FileHandle->Write(WriteBuffer.GetData(), WriteBuffer.Num());
+				FileHandle->Flush();
+				WriteBuffer.Reset();
+			}
+		}
+
+	private:
+		TUniquePtr<IFileHandle> FileHandle;
+		FRunnableThread* Thread = nullptr;
+		FEvent* WakeEvent = nullptr;
+		std::atomic<bool> bStopRequested = false;
+		const double StartTime;
+
+		FCriticalSection PendingLock;
+		TArray<uint8> PendingBuffer;
+		uint32 NumDropped = 0;
+		TMap<uint32, TWeakObjectPtr<const UObject>> KnownManagers;
+		TBitArray<> KnownTags;
+
+		/** Only touched by the writer thread. */
+		TArray<uint8> WriteBuffer;
+	};
+
+	FCriticalSection WriterLock;
+	TUniquePtr<FJournalWriter> Writer;
+
+	void HandleStartCommand(const TArray<FString>& Args)
+	{
+		Start(Args.IsValidIndex(0) ? Args[0] : FString());
+	}
+
+	FAutoConsoleCommand StartCommand(
+		TEXT("gtm.Journal.Start"),
+		TEXT("Starts writing every tag change to a binary journal. Optionally takes the file to write to; defaults to "
+			"a new file in Saved/Profiling/GameplayTagManager. Convert it with -run=GTM_TagJournal."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleStartCommand));
+
+	FAutoConsoleCommand StopCommand(
+		TEXT("gtm.Journal.Stop"),
+		TEXT("Stops writing the tag journal and closes its file."),
+		FConsoleCommandDelegate::CreateStatic(&Stop));
+}
+
+namespace GameplayTagManager::TagJournal
+{
+	void Start(const FString& FilePath)
+	{
+		Stop();
+
+		const FString Path = !FilePath.IsEmpty() ? FilePath : FPaths::ProfilingDir() / TEXT("GameplayTagManager") /
+			FString::Printf(TEXT("TagJournal-%s.gtmj"), *FDateTime::Now().ToString());
+
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(Path), true);
+		IFileHandle* FileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*Path);
+		if (!FileHandle)
+		{
+			UE_LOG(LogGameplayTagManager, Error, TEXT("Failed to open tag journal %s for writing"), *Path);
+			return;
+		}
+
+		TArray<uint8> Header;
+		FMemoryWriter HeaderWriter(Header);
+		uint32 Magic = FileMagic;
+		uint32 Version = FileVersion;
+		HeaderWriter << Magic;
+		HeaderWriter << Version;
+		FileHandle->Write(Header.GetData(), Header.Num());
+
+		{
+			FScopeLock Lock(&WriterLock);
+			Writer = MakeUnique<FJournalWriter>(FileHandle);
+		}
+
+		bIsRecording = true;
+		UE_LOG(LogGameplayTagManager, Log, TEXT("Writing tag journal to %s"), *Path);
+	}
+
+	void Stop()
+	{
+		bIsRecording = false;
+
+		// Wait for the records in flight before tearing the writer down
+		FScopeLock Lock(&WriterLock);
+		if (Writer)
+		{
+			Writer.Reset();
+			UE_LOG(LogGameplayTagManager, Log, TEXT("Stopped writing tag journal"));
+		}
+	}
+
+	void RecordTagChanged(const UObject* Manager, EGTM_StackContainerId ContainerId, FGameplayTag Tag,
+		int32 OldCount, int32 NewCount)
+	{
+		const FPendingChange Change { Manager, Tag, ContainerId, OldCount, NewCount, GFrameCounter,
+			FPlatformTime::Seconds() };
+
+		if (GBatchDepth > 0)
+		{
+			GBatchedChanges.Add(Change);
+			return;
+		}
+
+		FScopeLock Lock(&WriterLock);
+		if (Writer)
+		{
+			Writer->Record(MakeArrayView(&Change, 1));
+		}
+	}
+
+	FScopedRecordBatch::FScopedRecordBatch()
+	{
+		++GBatchDepth;
+	}
+
+	FScopedRecordBatch::~FScopedRecordBatch()
+	{
+		if (--GBatchDepth > 0 || GBatchedChanges.IsEmpty())
+		{
+			return;
+		}
+
+		{
+			FScopeLock Lock(&WriterLock);
+			if (Writer)
+			{
+				Writer->Record(GBatchedChanges);
+			}
+		}
+
+		// The allocation is kept for the next batch of this thread
+		GBatchedChanges.Reset();
+	}
+}
+#endif
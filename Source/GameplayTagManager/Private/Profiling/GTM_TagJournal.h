@@ -0,0 +1,60 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "Gameplay/Misc/GTM_GameplayTagTypes.h"
+
+#if !defined(GTM_TAG_JOURNAL_ENABLED)
+#define GTM_TAG_JOURNAL_ENABLED !UE_BUILD_SHIPPING
+#endif
+
+#if GTM_TAG_JOURNAL_ENABLED
+#include <atomic>
+
+namespace GameplayTagManager::TagJournal
+{
+	/** Set while a journal is being written. Checked before anything else to keep the disabled cost to a single load. */
+	extern std::atomic<bool> bIsRecording;
+
+	/**
+	 * Starts writing every tag change to the given file, or to a new file in Saved/Profiling/GameplayTagManager.
+	 * Also started by the -GTMJournal[=<File>] command line switch.
+	 */
+	void Start(const FString& FilePath = FString());
+	void Stop();
+
+	/** Queues the change for the writer thread. Thread safe. */
+	void RecordTagChanged(const UObject* Manager, EGTM_StackContainerId ContainerId, FGameplayTag Tag,
+		int32 OldCount, int32 NewCount);
+
+	/**
+	 * Holds back the changes recorded on this thread while alive, and queues them all at once when the outermost
+	 * scope ends. Keeps worker threads applying many changes from contending on every one of them.
+	 */
+	class FScopedRecordBatch
+	{
+	public:
+		FScopedRecordBatch();
+		~FScopedRecordBatch();
+
+		UE_NONCOPYABLE(FScopedRecordBatch);
+	};
+}
+
+#define GTM_JOURNAL_TAG_CHANGED(Manager, ContainerId, Tag, OldCount, NewCount) \
+	do \
+	{ \
+		if (GameplayTagManager::TagJournal::bIsRecording.load(std::memory_order_relaxed)) \
+		{ \
+			GameplayTagManager::TagJournal::RecordTagChanged(Manager, ContainerId, Tag, OldCount, NewCount); \
+		} \
+	} \
+	while (false)
+
+#define GTM_JOURNAL_BATCH_SCOPE() \
+	const GameplayTagManager::TagJournal::FScopedRecordBatch ANONYMOUS_VARIABLE(JournalBatch)
+#else
+#define GTM_JOURNAL_TAG_CHANGED(...)
+#define GTM_JOURNAL_BATCH_SCOPE()
+#endif
@@ -0,0 +1,40 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Profiling/GTM_Trace.h"
+
+#if GTM_TRACE_ENABLED
+#include "GameplayTagsManager.h"
+#include "HAL/PlatformTime.h"
+
+UE_TRACE_CHANNEL_DEFINE(GameplayTagManagerChannel);
+
+UE_TRACE_EVENT_BEGIN(GameplayTagManager, TagChanged)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, ManagerId)
+	UE_TRACE_EVENT_FIELD(int32, OldCount)
+	UE_TRACE_EVENT_FIELD(int32, NewCount)
+	UE_TRACE_EVENT_FIELD(uint16, TagNetIndex)
+	UE_TRACE_EVENT_FIELD(uint8, ContainerId)
+UE_TRACE_EVENT_END()
+
+namespace GameplayTagManager::Trace
+{
+	void OutputTagChanged(const UObject* Manager, EGTM_StackContainerId ContainerId, FGameplayTag Tag,
+		int32 OldCount, int32 NewCount)
+	{
+		if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(GameplayTagManagerChannel))
+		{
+			return;
+		}
+
+		const FGameplayTagNetIndex TagNetIndex = UGameplayTagsManager::Get().GetNetIndexFromTag(Tag);
+		UE_TRACE_LOG(GameplayTagManager, TagChanged, GameplayTagManagerChannel)
+			<< TagChanged.Cycle(FPlatformTime::Cycles64())
+			<< TagChanged.ManagerId(Manager ? Manager->GetUniqueID() : 0)
+			<< TagChanged.OldCount(OldCount)
+			<< TagChanged.NewCount(NewCount)
+			<< TagChanged.TagNetIndex(TagNetIndex)
+			<< TagChanged.ContainerId(static_cast<uint8>(ContainerId));
+	}
+}
+#endif
@@ -0,0 +1,32 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "Gameplay/Misc/GTM_GameplayTagTypes.h"
+#include "Trace/Config.h"
+
+#if !defined(GTM_TRACE_ENABLED)
+#define GTM_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+#if GTM_TRACE_ENABLED
+#include "Trace/Trace.h"
+
+UE_TRACE_CHANNEL_EXTERN(GameplayTagManagerChannel);
+
+namespace GameplayTagManager::Trace
+{
+	/**
+	 * Emits a compact tag change event on the GameplayTagManager trace channel. The tag is identified by its
+	 * net index, which can be resolved with the project's gameplay tag table.
+	 */
+	void OutputTagChanged(const UObject* Manager, EGTM_StackContainerId ContainerId, FGameplayTag Tag,
+		int32 OldCount, int32 NewCount);
+}
+
+#define GTM_TRACE_TAG_CHANGED(Manager, ContainerId, Tag, OldCount, NewCount) \
+	GameplayTagManager::Trace::OutputTagChanged(Manager, ContainerId, Tag, OldCount, NewCount)
+#else
+#define GTM_TRACE_TAG_CHANGED(...)
+#endif
@@ -0,0 +1,97 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Settings/GTM_GameplayTagManagerSettings.h"
+
+#include "Misc/ScopeRWLock.h"
+
+UGTM_GameplayTagManagerSettings::UGTM_GameplayTagManagerSettings()
+{
+	CategoryName = "Plugins";
+}
+
+const UGTM_GameplayTagManagerSettings* UGTM_GameplayTagManagerSettings::Get()
+{
+	return GetDefault<UGTM_GameplayTagManagerSettings>();
+}
+
+EGTM_ReplicationChannel UGTM_GameplayTagManagerSettings::GetReplicationChannel(FGameplayTag Tag) const
+{
+	if (ReplicationChannelRoutes.IsEmpty())
+	{
+		return EGTM_ReplicationChannel::Default;
+	}
+
+	{
+		FReadScopeLock ReadLock(CachedReplicationChannelsLock);
+		if (const EGTM_ReplicationChannel* FoundChannel = CachedReplicationChannels.Find(Tag))
+		{
+			return *FoundChannel;
+		}
+	}
+
+	// Pick the most specific route; a deeper root always has a longer name than its parents
+	EGTM_ReplicationChannel Channel = EGTM_ReplicationChannel::Default;
+	int32 BestRootLength = INDEX_NONE;
+	for (const FGTM_ReplicationChannelRoute& Route : ReplicationChannelRoutes)
+	{
+		if (!Route.TagRoot.IsValid() || !Tag.MatchesTag(Route.TagRoot))
+		{
+			continue;
+		}
+
+		const int32 RootLength = Route.TagRoot.GetTagName().GetStringLength();
+		if (RootLength > BestRootLength)
+		{
+			BestRootLength = RootLength;
+			Channel = Route.Channel;
+		}
+	}
+
+	FWriteScopeLock WriteLock(CachedReplicationChannelsLock);
+	CachedReplicationChannels.Add(Tag, Channel);
+	return Channel;
+}
+
+bool UGTM_GameplayTagManagerSettings::IsChannelRouted(EGTM_ReplicationChannel Channel) const
+{
+	if (Channel == EGTM_ReplicationChannel::Default)
+	{
+		return true;
+	}
+
+	return ReplicationChannelRoutes.ContainsByPredicate([Channel](const FGTM_ReplicationChannelRoute& Route)
+	{
+		return Route.TagRoot.IsValid() && Route.Channel == Channel;
+	});
+}
+
+ELifetimeCondition UGTM_GameplayTagManagerSettings::GetCustomChannelLifetimeCondition() const
+{
+	switch (CustomChannelCondition)
+	{
+		case EGTM_ReplicationCondition::None:
+			return COND_None;
+		case EGTM_ReplicationCondition::OwnerOnly:
+			return COND_OwnerOnly;
+		case EGTM_ReplicationCondition::SkipOwner:
+			return COND_SkipOwner;
+		case EGTM_ReplicationCondition::SimulatedOnly:
+			return COND_SimulatedOnly;
+		case EGTM_ReplicationCondition::AutonomousOnly:
+			return COND_AutonomousOnly;
+		case EGTM_ReplicationCondition::Custom:
+			return COND_Custom;
+		default:
+			return COND_None;
+	}
+}
+
+#if WITH_EDITOR
+void UGTM_GameplayTagManagerSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	FWriteScopeLock WriteLock(CachedReplicationChannelsLock);
+	CachedReplicationChannels.Reset();
+}
+#endif
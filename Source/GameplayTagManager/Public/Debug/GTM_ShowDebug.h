@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include "Containers/StaticArray.h"
+#include "Debug/GTM_WorldOverview.h"
 #include "GameplayTagContainer.h"
 
 class UGameplayTagManager;
@@ -17,6 +19,29 @@ namespace GameplayTagManager
 		Removed,
 	};
 
+	/** Tag count change received from a tracked manager. */
+	struct FTagChangeRecord
+	{
+	public:
+		ETagAction GetAction() const;
+
+	public:
+		FGameplayTag Tag;
+		int32 OldCount = 0;
+		int32 NewCount = 0;
+		float Timestamp = 0.f;
+
+		/** Index of the tracked manager the change comes from. */
+		uint8 ManagerIndex = 0;
+	};
+
+	struct FTrackedTagManager
+	{
+	public:
+		TWeakObjectPtr<UGameplayTagManager> TagManager = nullptr;
+		FDelegateHandle DelegateHandle;
+	};
+
 #if ENABLE_DRAW_DEBUG
 	struct FShowDebugContext
 	{
@@ -41,51 +66,48 @@ namespace GameplayTagManager
 		float& YPos;
 	};
 
-	struct FSerializedTagData_Normal
-	{
-	public:
-		bool operator==(const FSerializedTagData_Normal& Rhs) const;
-
-	public:
-		FGameplayTag Tag;
-		int32 Count = 0;
-
-		ETagAction LastAction = ETagAction::Invalid;
-		float LastActionTimestamp = 0.f;
-
-		FString AdditionalData;
-	};
-
-	struct FSerializedTagManagerData_Normal
+	/**
+	 * Draws the tags of the debug target's managers along with their latest changes. Changes are captured as they
+	 * happen into a fixed ring buffer, and only turned into strings while drawing. There is a single instance per
+	 * simulation, created the first time ShowDebug is drawn in it, so managers don't pay for it.
+	 */
+	struct FGTM_ShowDebug
 	{
 	public:
-		FSerializedTagData_Normal& GetSerializedTag(FGameplayTag InTag);
+		static constexpr int32 MaxRecords = 128;
 
 	public:
-		TWeakObjectPtr<const UGameplayTagManager> TagManager = nullptr;
-		TArray<FSerializedTagData_Normal> SerializedTags;
-		TMap<FGameplayTag, int32> LastTags;
-		float TrackingStartTimestamp = 0.f;
-	};
+		FGTM_ShowDebug() = default;
+		FGTM_ShowDebug(const FGTM_ShowDebug&) = delete;
+		FGTM_ShowDebug& operator=(const FGTM_ShowDebug&) = delete;
+		~FGTM_ShowDebug();
 
-	struct FGTM_ShowDebug
-	{
-	public:
-		void ShowDebugInfo(const FShowDebugContext& InContext, FShowDebugIntermediate& InIntermediateData);
+		/** Draws using the instance of the simulation being drawn; called by every manager, drawn once a frame. */
+		static void ShowDebugInfo(const FShowDebugContext& InContext, FShowDebugIntermediate& InIntermediateData);
 
 	private:
+		void ShowDebugInfoImpl(const FShowDebugContext& InContext, FShowDebugIntermediate& InIntermediateData);
 		void CollectData(AActor* InDebugActor);
 		void DrawData(const FShowDebugContext& InContext, FShowDebugIntermediate& InIntermediateData);
+		void DrawOverview(const FShowDebugContext& InContext);
 
-	private:
-		FSerializedTagManagerData_Normal& GetDebugData(const UGameplayTagManager* TagManager);
+		void StartTracking(UGameplayTagManager* TagManager);
+		void StopTracking();
+		void OnTagCountChanged(UGameplayTagManager* TagManager, FGameplayTag Tag, int32 OldCount, int32 NewCount);
 
 	private:
-		inline static TMap<int32, uint64> LastHandledFrameAcrossSimulations;
+		inline static TMap<int32, TUniquePtr<FGTM_ShowDebug>> ShowDebugAcrossSimulations;
 
 	private:
-		TArray<FSerializedTagManagerData_Normal> DebugData;
+		uint64 LastHandledFrame = 0;
+		FGTM_WorldOverview WorldOverview;
+
+		TArray<FTrackedTagManager, TInlineAllocator<3>> TrackedManagers;
 		TWeakObjectPtr<AActor> LastDebugActor = nullptr;
+
+		TStaticArray<FTagChangeRecord, MaxRecords> Records;
+		int32 NextRecordIndex = 0;
+		int32 NumRecords = 0;
 	};
 #endif
 }
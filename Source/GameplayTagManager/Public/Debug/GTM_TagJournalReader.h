@@ -0,0 +1,73 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Tag change journals are append-only binary files written by gtm.Journal.Start. After the file header, the journal
+ * is a stream of records, each one starting with its ERecordType. Names are only written the first time a manager or a
+ * tag appears, every tag change refers to them by id.
+ */
+namespace GameplayTagManager::TagJournal
+{
+	constexpr uint32 FileMagic = 0x4A4D5447; // "GTMJ"
+	constexpr uint32 FileVersion = 1;
+
+	enum class ERecordType : uint8
+	{
+		TagChanged,
+		ManagerName,
+		TagName,
+
+		/** Records lost since the previous record because the writer couldn't keep up. */
+		Dropped,
+	};
+
+	struct FTagChangedRecord
+	{
+	public:
+		void Serialize(FArchive& Ar);
+
+	public:
+		/** UObject unique ID of the manager. Resolved by a ManagerName record. */
+		uint32 ManagerId = 0;
+
+		/** Gameplay tag net index. Resolved by a TagName record. */
+		uint16 TagNetIndex = 0;
+
+		/** EGTM_StackContainerId of the changed container. */
+		uint8 ContainerId = 0;
+
+		int32 OldCount = 0;
+		int32 NewCount = 0;
+		uint64 Frame = 0;
+
+		/** Seconds since the journal was started. */
+		double Time = 0.0;
+	};
+
+	/**
+	 * Streams the tag changes of a journal file, keeping track of the names met on the way.
+	 */
+	class GAMEPLAYTAGMANAGER_API FReader
+	{
+	public:
+		bool Open(const FString& FilePath);
+
+		/** Reads up to the next tag change. Returns false once the journal ends. */
+		bool ReadNext(FTagChangedRecord& OutRecord);
+
+		FString GetManagerName(uint32 ManagerId) const;
+		FString GetTagName(uint16 TagNetIndex) const;
+
+		/** Amount of records the writer had to drop up until the current position. */
+		uint64 GetNumDropped() const;
+
+	private:
+		TUniquePtr<FArchive> Archive;
+		TMap<uint32, FString> ManagerNames;
+		TMap<uint16, FString> TagNames;
+		uint64 NumDropped = 0;
+	};
+}
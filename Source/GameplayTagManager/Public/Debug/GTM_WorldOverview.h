@@ -0,0 +1,67 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UGameplayTagManager;
+
+namespace GameplayTagManager
+{
+	enum class EOverviewCulling : uint8
+	{
+		None,
+		Distance,
+		View,
+		Num,
+	};
+
+	FString LexToString(EOverviewCulling Culling);
+
+	struct FOverviewEntry
+	{
+	public:
+		TWeakObjectPtr<const UGameplayTagManager> TagManager = nullptr;
+		double LastTagChangeTime = 0.0;
+		float Distance = 0.f;
+	};
+
+	/**
+	 * Every registered manager of a world, most recently changed first. Managers are gathered a slice per frame, and
+	 * the entries are only replaced once a whole pass is done, so the cost doesn't scale with the amount of managers.
+	 */
+	class GAMEPLAYTAGMANAGER_API FGTM_WorldOverview
+	{
+	public:
+		/**
+		 * Gathers the next slice of managers around the view.
+		 * @return	True if a pass was completed and the entries have changed.
+		 */
+		bool Collect(const UWorld* World, const FVector& ViewLocation, const FRotator& ViewRotation);
+		void Reset();
+
+		void SetCulling(EOverviewCulling InCulling);
+		EOverviewCulling GetCulling() const;
+		void CycleCulling();
+
+		void SetPage(int32 InPage);
+		void NextPage();
+		void PreviousPage();
+		int32 GetPage() const;
+		int32 GetNumPages() const;
+
+		/** Entries of the current page. */
+		TConstArrayView<FOverviewEntry> GetPageEntries() const;
+
+		/** Amount of managers that passed culling during the last pass. */
+		int32 GetNumEntries() const;
+
+	private:
+		TArray<FOverviewEntry> Entries;
+		TArray<FOverviewEntry> PendingEntries;
+		int32 NextManagerIndex = 0;
+
+		int32 Page = 0;
+		EOverviewCulling Culling = EOverviewCulling::Distance;
+	};
+}
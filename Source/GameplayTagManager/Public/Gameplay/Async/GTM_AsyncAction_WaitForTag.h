@@ -0,0 +1,106 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "Gameplay/Async/GTM_TagWait.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+
+#include "GTM_AsyncAction_WaitForTag.generated.h"
+
+class UGameplayTagManager;
+class UGTM_AsyncAction_WaitForTag;
+
+/**
+ * Refers to a single wait of a pooled action. Goes stale once the action triggers or is cancelled, so it never
+ * affects the waits the action is recycled for afterwards.
+ */
+USTRUCT(BlueprintType)
+struct GAMEPLAYTAGMANAGER_API FGTM_TagWaitHandle
+{
+	GENERATED_BODY()
+
+public:
+	TWeakObjectPtr<UGTM_AsyncAction_WaitForTag> Action;
+
+	/** Serial of the action's wait the handle was taken for. */
+	uint32 Serial = 0;
+};
+
+/**
+ * Waits for a manager to reach a tag state, triggering right away if it's already in it. Actions are recycled through
+ * a per-world pool once they trigger or are cancelled, so a returned action mustn't be used after that; take its
+ * handle right away to cancel it later.
+ */
+UCLASS()
+class GAMEPLAYTAGMANAGER_API UGTM_AsyncAction_WaitForTag
+	: public UBlueprintAsyncActionBase
+{
+	GENERATED_BODY()
+
+public:
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
+		FOnTagWaitFinishedSignature,
+		UGameplayTagManager*, Manager);
+
+public:
+	UFUNCTION(BlueprintCallable, Category="Gameplay Tags|Tasks", meta=(BlueprintInternalUseOnly="true"))
+	static UGTM_AsyncAction_WaitForTag* WaitTagAdded(UGameplayTagManager* Manager, FGameplayTag Tag);
+
+	UFUNCTION(BlueprintCallable, Category="Gameplay Tags|Tasks", meta=(BlueprintInternalUseOnly="true"))
+	static UGTM_AsyncAction_WaitForTag* WaitTagRemoved(UGameplayTagManager* Manager, FGameplayTag Tag);
+
+	UFUNCTION(BlueprintCallable, Category="Gameplay Tags|Tasks", meta=(BlueprintInternalUseOnly="true",
+		DisplayName="Wait Tag Count At Least"))
+	static UGTM_AsyncAction_WaitForTag* WaitTagCountAtLeast(UGameplayTagManager* Manager, FGameplayTag Tag,
+		int32 Count = 1);
+
+	UFUNCTION(BlueprintCallable, Category="Gameplay Tags|Tasks", meta=(BlueprintInternalUseOnly="true"))
+	static UGTM_AsyncAction_WaitForTag* WaitQueryMatch(UGameplayTagManager* Manager, FGameplayTagQuery Query);
+
+	//~UBlueprintAsyncActionBase Interface
+	virtual void Activate() override;
+	//~End of UBlueprintAsyncActionBase Interface
+
+	/** Returns the handle of the current wait. Take it right after starting to wait, before the action is recycled. */
+	UFUNCTION(BlueprintPure, Category="Gameplay Tags|Tasks")
+	FGTM_TagWaitHandle GetHandle() const;
+
+	/**
+	 * Stops waiting without triggering, and returns the action to the pool. Returns false if the wait already ended,
+	 * in which case the action, possibly waiting for something else by now, is left alone.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Gameplay Tags|Tasks")
+	static bool CancelWait(const FGTM_TagWaitHandle& Handle);
+
+private:
+	static UGTM_AsyncAction_WaitForTag* Acquire(UGameplayTagManager* Manager,
+		const GameplayTagManager::FTagWaitCondition& InCondition);
+
+	void OnManagerChanged();
+	void Trigger();
+	void Fail();
+
+	/** Ends the current wait, invalidating its handles, and returns the action to the pool. */
+	void Release();
+
+	/** Ends the current wait, invalidating its handles, without returning the action to the pool yet. */
+	void EndWait();
+	void ReturnToPool();
+
+public:
+	UPROPERTY(BlueprintAssignable)
+	FOnTagWaitFinishedSignature OnConditionMet;
+
+	/** Called instead of OnConditionMet if the wait couldn't start, e.g. because the manager was invalid. */
+	UPROPERTY(BlueprintAssignable)
+	FOnTagWaitFinishedSignature OnFailed;
+
+private:
+	GameplayTagManager::FTagWaitCondition Condition;
+	GameplayTagManager::FTagWaitBinding Binding;
+	TWeakObjectPtr<UGameplayTagManager> WaitedManager;
+	bool bIsActive = false;
+
+	/** Changes every time the action is released, invalidating the handles to its previous wait. */
+	uint32 Serial = 1;
+};
@@ -0,0 +1,77 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "Async/Future.h"
+#include "GameplayTagContainer.h"
+
+#include "GTM_TagWait.generated.h"
+
+class UGameplayTagManager;
+
+/**
+ * State of a manager a tag wait is waiting for.
+ */
+UENUM(BlueprintType)
+enum class EGTM_TagWaitType : uint8
+{
+	/** The tag is present. */
+	Added,
+
+	/** The tag isn't present. */
+	Removed,
+
+	/** The tag count is at least the given count. */
+	CountAtLeast,
+
+	/** The tag query matches. */
+	QueryMatch,
+};
+
+namespace GameplayTagManager
+{
+	struct GAMEPLAYTAGMANAGER_API FTagWaitCondition
+	{
+	public:
+		static FTagWaitCondition TagAdded(FGameplayTag Tag);
+		static FTagWaitCondition TagRemoved(FGameplayTag Tag);
+		static FTagWaitCondition TagCountAtLeast(FGameplayTag Tag, int32 Count);
+		static FTagWaitCondition QueryMatch(const FGameplayTagQuery& Query);
+
+		bool IsMet(const UGameplayTagManager& Manager) const;
+
+	public:
+		EGTM_TagWaitType Type = EGTM_TagWaitType::Added;
+		FGameplayTag Tag;
+		int32 Count = 1;
+		FGameplayTagQuery Query;
+	};
+
+	/**
+	 * Listens to the manager's changes that can meet a condition, using the cheapest listener for its type. The
+	 * callback is copied before being invoked, so it may unbind and release whatever it captures.
+	 */
+	struct GAMEPLAYTAGMANAGER_API FTagWaitBinding
+	{
+	public:
+		FTagWaitBinding() = default;
+		FTagWaitBinding(const FTagWaitBinding&) = delete;
+		FTagWaitBinding& operator=(const FTagWaitBinding&) = delete;
+		~FTagWaitBinding();
+
+		void Bind(UGameplayTagManager& InManager, EGTM_TagWaitType InType, FGameplayTag Tag,
+			TFunction<void()> Callback);
+		void Unbind();
+
+	private:
+		TWeakObjectPtr<UGameplayTagManager> Manager;
+		FDelegateHandle DelegateHandle;
+		EGTM_TagWaitType Type = EGTM_TagWaitType::Added;
+	};
+
+	/**
+	 * Native counterpart of the wait for tag async actions. The future is set to true once the condition is met, or to
+	 * false if the manager is destroyed first. Game thread only; continuations run inside the manager's notification.
+	 */
+	GAMEPLAYTAGMANAGER_API TFuture<bool> WaitForTag(UGameplayTagManager* Manager, const FTagWaitCondition& Condition);
+}
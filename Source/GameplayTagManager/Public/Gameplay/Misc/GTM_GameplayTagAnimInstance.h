@@ -0,0 +1,53 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "Animation/AnimInstance.h"
+#include "Gameplay/Misc/GTM_GameplayTagBlueprintPropertyMap.h"
+
+#include "GTM_GameplayTagAnimInstance.generated.h"
+
+/**
+ * Animation instance mapping gameplay tags onto its properties. Tag changes are staged as they happen and only written
+ * to the properties in PreUpdateAnimation, so the properties can be read from the thread safe animation update.
+ */
+UCLASS()
+class GAMEPLAYTAGMANAGER_API UGTM_GameplayTagAnimInstance
+	: public UAnimInstance
+{
+	GENERATED_BODY()
+
+public:
+	UGTM_GameplayTagAnimInstance();
+
+	/** Returns the count of a mapped tag as of the last animation update. */
+	UFUNCTION(BlueprintPure, Category="Gameplay Tags", meta=(BlueprintThreadSafe))
+	int32 GetMappedTagCount(FGameplayTag Tag) const;
+
+	/** Returns whether a mapped tag was present as of the last animation update. */
+	UFUNCTION(BlueprintPure, Category="Gameplay Tags", meta=(BlueprintThreadSafe))
+	bool HasMappedTag(FGameplayTag Tag) const;
+
+protected:
+	//~UAnimInstance Interface
+	virtual void NativeInitializeAnimation() override;
+	virtual void PreUpdateAnimation(float DeltaSeconds) override;
+	virtual void NativeUninitializeAnimation() override;
+	//~End of UAnimInstance Interface
+
+	/** Returns the manager to map the tags of. By default the one of the owning actor. */
+	virtual UGameplayTagManager* FindGameplayTagManager() const;
+
+private:
+	/** Initializes the property map if the manager can be found, otherwise schedules the next attempt. */
+	void TryInitializePropertyMap();
+
+protected:
+	UPROPERTY(EditDefaultsOnly, Category="Gameplay Tags")
+	FGTM_GameplayTagBlueprintPropertyMap GameplayTagPropertyMap;
+
+private:
+	/** Time until the manager is looked for again, and the delay between the last two attempts. */
+	float InitializeRetryTimeLeft = 0.f;
+	float InitializeRetryInterval = 0.f;
+};
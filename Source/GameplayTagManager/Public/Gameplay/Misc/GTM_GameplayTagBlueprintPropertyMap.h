@@ -12,20 +12,13 @@ class UGameplayTagManager;
 /**
  * Struct used to update a blueprint property with a gameplay tag count.
  * The property is automatically updated as the gameplay tag count changes.
- * It only supports booleans.
+ * Booleans are set while the tag is present, integers and floats are set to its count.
  */
 USTRUCT()
 struct GAMEPLAYTAGMANAGER_API FGTM_GameplayTagBlueprintPropertyMapping
 {
 	GENERATED_BODY()
 
-public:
-	FGTM_GameplayTagBlueprintPropertyMapping() = default;
-	FGTM_GameplayTagBlueprintPropertyMapping(const FGTM_GameplayTagBlueprintPropertyMapping& Other);
-
-	// Pretty weird that the assignment operator copies the handle when the copy constructor doesn't - bug?
-	FGTM_GameplayTagBlueprintPropertyMapping& operator=(const FGTM_GameplayTagBlueprintPropertyMapping& Other) = default;
-
 public:
 	/** Gameplay tag being counted. */
 	UPROPERTY(EditAnywhere, Category="Gameplay Tag Blueprint Property")
@@ -42,9 +35,6 @@ public:
 	/** Guid of property being edited. */
 	UPROPERTY(VisibleAnywhere, Category="Gameplay Tag Blueprint Property")
 	FGuid PropertyGuid;
-
-	/** Handle to delegate bound on the ability system component. */
-	FDelegateHandle DelegateHandle;
 };
 
 USTRUCT()
@@ -66,21 +56,67 @@ public:
 	/** Call to manually apply the current tag state, can handle cases where callbacks were skipped */
 	void ApplyCurrentTags();
 
+	/**
+	 * Makes tag changes only update the properties when ApplyDeferredValues is called, so that they can be read from
+	 * other threads in between, e.g. by a thread safe animation update. Call before initializing.
+	 */
+	void SetDeferred(bool bInDeferred);
+
+	/** Writes the tag changes received since the last call to the properties. */
+	void ApplyDeferredValues();
+
+	/**
+	 * Returns the count of a mapped tag as last written to the properties. Deferred only; safe to call from other
+	 * threads while ApplyDeferredValues isn't running.
+	 */
+	int32 GetAppliedCount(FGameplayTag Tag) const;
+
+	bool IsInitialized() const;
+
+	/** Unbinds from the gameplay tag manager. Called on destruction. */
+	void Unregister();
+
 #if WITH_EDITOR
 	/** This can optionally be called in the owner's IsDataValid() for data validation. */
 	EDataValidationResult IsDataValid(const UObject* ContainingAsset, FDataValidationContext& Context) const;
 #endif
 
 protected:
-	void Unregister();
+	/** Resolved offsets and types of the mapped properties, shared by every map of a class with the same mappings. */
+	struct FBindingLayout;
+
+protected:
 	bool IsPropertyTypeValid(const FProperty* Property) const;
 
 	void GameplayTagEventCallback(UGameplayTagManager* Manager, FGameplayTag Tag, bool bIsPresent);
+	void GameplayTagCountCallback(UGameplayTagManager* Manager, FGameplayTag Tag, int32 OldCount, int32 NewCount);
+	void ApplyTag(FGameplayTag Tag, int32 Count);
+
+	/**
+	 * Brings every mapped property up to date with the manager in one pass. Deferred maps stage the values unless
+	 * told to write them now.
+	 */
+	void SyncAllTags(bool bWriteNow);
+	void WriteTag(FGameplayTag Tag, int32 Count);
 
 protected:
 	UPROPERTY(EditAnywhere, Category="Gameplay Tag Blueprint Property")
 	TArray<FGTM_GameplayTagBlueprintPropertyMapping> PropertyMappings;
 
+	/** Set on initialize. */
+	TSharedPtr<const FBindingLayout> Layout;
+
+	/** Presence listeners of the tags that are only mapped to booleans. */
+	TArray<FDelegateHandle, TInlineAllocator<4>> DelegateHandles;
+
+	/** Count listeners of the tags mapped to at least one integer or float. */
+	TArray<FDelegateHandle, TInlineAllocator<4>> CountDelegateHandles;
+
+	/** Counts received but not written yet, and counts as of the last write. Deferred only. */
+	TMap<FGameplayTag, int32> PendingCounts;
+	TMap<FGameplayTag, int32> AppliedCounts;
+	bool bDeferred = false;
+
 	TWeakObjectPtr<UObject> CachedOwner;
 	TWeakObjectPtr<UGameplayTagManager> CachedGameplayTagManager;
 };
@@ -0,0 +1,49 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "Gameplay/Misc/GTM_GameplayTagTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "GTM_GameplayTagManagerSubsystem.generated.h"
+
+class UGameplayTagManager;
+class UGTM_AsyncAction_WaitForTag;
+
+/**
+ * World-level access to gameplay tag managers.
+ */
+UCLASS()
+class GAMEPLAYTAGMANAGER_API UGTM_GameplayTagManagerSubsystem
+	: public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UGTM_GameplayTagManagerSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Applies the same operations to every manager, notifying each of them once and marking each changed container
+	 * dirty once. If allowed, managers with bAllowParallelBulkMutation are processed on worker threads.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Gameplay Tags", meta=(AdvancedDisplay="bAllowParallel"))
+	void ApplyBulkTagOperations(const TArray<UGameplayTagManager*>& Managers,
+		const TArray<FGTM_TagOperation>& Operations, bool bAllowParallel = true);
+
+	/** Called by managers on begin and end play. */
+	void RegisterManager(UGameplayTagManager* Manager);
+	void UnregisterManager(UGameplayTagManager* Manager);
+
+	/** Every manager that has begun play in this world. Order isn't stable across unregistrations. */
+	const TArray<TWeakObjectPtr<UGameplayTagManager>>& GetRegisteredManagers() const;
+
+	/** Recycling of finished wait for tag actions. Returns null if the pool is empty. */
+	UGTM_AsyncAction_WaitForTag* PopPooledWaitAction();
+	void PushPooledWaitAction(UGTM_AsyncAction_WaitForTag* Action);
+
+private:
+	TArray<TWeakObjectPtr<UGameplayTagManager>> RegisteredManagers;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UGTM_AsyncAction_WaitForTag>> PooledWaitActions;
+};
@@ -3,8 +3,10 @@
 #pragma once
 
 #include "GameplayTagContainer.h"
+#include "Gameplay/Misc/GTM_GameplayTagTypes.h"
 #include "Net/Serialization/FastArraySerializer.h"
 #include "UObject/Object.h"
+#include "UObject/ObjectKey.h"
 
 #include "GTM_GameplayTagStackContainer.generated.h"
 
@@ -28,8 +30,45 @@ public:
 
 	UPROPERTY(VisibleInstanceOnly)
 	int32 StackCount = 0;
+
+	// Count the receiving side had before the latest replicated change, as the change overwrites StackCount
+	UPROPERTY(NotReplicated)
+	int32 PreviousStackCount = 0;
 };
 
+namespace GameplayTagManager
+{
+	/** Stacks a non-replicated container keeps inline before it spills them to the heap. */
+	constexpr int32 NumInlineLocalStacks = 4;
+	using FLocalTagStackArray = TArray<FGTM_GameplayTagStack, TInlineAllocator<NumInlineLocalStacks>>;
+
+	/** Stacks added on behalf of a source, kept in a slot of the container's contribution arena. */
+	struct FTagContribution
+	{
+	public:
+		bool IsFree() const;
+
+	public:
+		FGameplayTag Tag;
+		FObjectKey Source;
+		int32 StackCount = 0;
+		uint16 Serial = 1;
+
+		/** Neighbours in the list of the source's contributions, or the next free slot if free. */
+		int32 PrevIndex = INDEX_NONE;
+		int32 NextIndex = INDEX_NONE;
+	};
+
+	/** Contributions of a container. Freed slots are chained through their NextIndex and reused before growing. */
+	struct FTagContributionArena
+	{
+	public:
+		TArray<FTagContribution> Contributions;
+		TMap<FObjectKey, int32> SourceToFirstContribution;
+		int32 FirstFreeContribution = INDEX_NONE;
+	};
+}
+
 /**
  * Container of gameplay tag stacks.
  */
@@ -39,9 +78,15 @@ struct FGTM_GameplayTagStackContainer
 {
 	GENERATED_BODY()
 
+public:
+	DECLARE_DELEGATE_ThreeParams(FOnStackCountChangedSignature, FGameplayTag /*Tag*/, int32 /*OldCount*/,
+		int32 /*NewCount*/);
+
 public:
 	FGTM_GameplayTagStackContainer() = default;
-	FGTM_GameplayTagStackContainer(UActorComponent* InOwner, const FString& InType);
+	FGTM_GameplayTagStackContainer(UActorComponent* InOwner, EGTM_StackContainerId InContainerId);
+	FGTM_GameplayTagStackContainer(const FGTM_GameplayTagStackContainer& Other);
+	FGTM_GameplayTagStackContainer& operator=(const FGTM_GameplayTagStackContainer& Other);
 
 	// Adds a specified number of stacks to the tag (does nothing if StackCount is below 1)
 	void AddStack(FGameplayTag Tag, int32 StackCount);
@@ -57,8 +102,43 @@ public:
 
 	// Returns true if there is at least one stack of the specified tag
 	bool ContainsTag(FGameplayTag Tag) const;
+
+	// Returns the accelerated tag to count map; always empty with compact storage, use AppendTagCounts instead
 	const TMap<FGameplayTag, int32>& GetTagToCountMap() const;
 	FGameplayTagContainer GetTags() const;
+	EGTM_StackContainerId GetContainerId() const;
+
+	// Adds stacks attributed to the source. Removing them through the returned handle takes away exactly these
+	// stacks, regardless of the other changes made to the tag. Contributions are local; only the stacks replicate.
+	// Whenever the stack count drops below what's contributed, e.g. when it's overridden or cleared, the newest
+	// contributions of the tag are clamped, or freed if nothing is left of them
+	FGTM_TagContributionHandle AddContribution(FGameplayTag Tag, int32 StackCount, FObjectKey Source);
+
+	// Removes the stacks of the contribution, or as many of them as are left. Returns false if the handle is stale
+	bool RemoveContribution(const FGTM_TagContributionHandle& Handle);
+
+	// Removes the stacks of every contribution of the source
+	void RemoveContributions(FObjectKey Source);
+
+	// Returns true if the source has at least one contribution
+	bool HasContributions(FObjectKey Source) const;
+
+	// Returns the stacks of the tag contributed by the source
+	int32 GetContributedStackCount(FObjectKey Source, FGameplayTag Tag) const;
+
+	// Adds the stack counts to the map, summing them with the counts already in there
+	void AppendTagCounts(TMap<FGameplayTag, int32>& InOutTagToCount) const;
+
+	// Adds the tags that have at least one stack to the container
+	void AppendTags(FGameplayTagContainer& InOutTags) const;
+
+	// Compact storage drops the accelerated lookup structures and scans the stacks instead, which is cheaper for the
+	// handful of tags most actors hold. Can only be changed while the container is empty
+	void SetCompactStorage(bool bInCompactStorage);
+	bool IsCompactStorage() const;
+
+	// Returns the heap memory used by the stacks and their lookup structures
+	SIZE_T GetAllocatedSize() const;
 
 	//~FFastArraySerializer Contract
 	void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
@@ -68,7 +148,38 @@ public:
 
 	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
 
+protected:
+	// Keeps the stacks in the given array instead of the replicated one; only for containers that never replicate
+	FGTM_GameplayTagStackContainer(UActorComponent* InOwner, EGTM_StackContainerId InContainerId,
+		GameplayTagManager::FLocalTagStackArray& InLocalStacks);
+
 private:
+	// Calls the function with the stack array in use, see LocalStacks
+	template<typename FuncType>
+	decltype(auto) VisitStacks(FuncType&& Func)
+	{
+		if (LocalStacks)
+		{
+			return Func(*LocalStacks);
+		}
+
+		return Func(Stacks);
+	}
+
+	template<typename FuncType>
+	decltype(auto) VisitStacks(FuncType&& Func) const
+	{
+		if (LocalStacks)
+		{
+			return Func(AsConst(*LocalStacks));
+		}
+
+		return Func(Stacks);
+	}
+
+	FGTM_GameplayTagStack* FindStack(FGameplayTag Tag);
+	const FGTM_GameplayTagStack* FindStack(FGameplayTag Tag) const;
+
 	void AddNewStackImpl(FGameplayTag InTag, int32 InStackCount);
 	void SetExistingStackCountImpl(FGTM_GameplayTagStack& InStack, int32 InNewCount);
 	void RemoveStackImpl(FGTM_GameplayTagStack& InStack);
@@ -79,9 +190,18 @@ private:
 
 	void BroadcastStateChanged();
 
+	GameplayTagManager::FTagContributionArena& GetOrCreateContributionArena();
+	void FreeContribution(int32 Index);
+
+	// Shrinks the contributions of the tag so that they don't add up to more than its stack count
+	void ClampContributions(FGameplayTag Tag, int32 StackCount);
+
 public:
 	FSimpleDelegate OnInternalsChangedDelegate;
 
+	// Called for every stack added, changed or removed, before OnInternalsChangedDelegate
+	FOnStackCountChangedSignature OnStackCountChangedDelegate;
+
 private:
 	// Replicated list of gameplay tag stacks
 	UPROPERTY(VisibleInstanceOnly)
@@ -94,10 +214,36 @@ private:
 	UPROPERTY(VisibleInstanceOnly, NotReplicated)
 	FGameplayTagContainer Tags;
 
+	// Stacks of a container that never replicates, set by FGTM_LocalTagStackContainer. The replicated array stays
+	// empty while this is set
+	GameplayTagManager::FLocalTagStackArray* LocalStacks = nullptr;
+
+	// Allocated on the first contribution, as most containers never get any. Kept afterwards, so that the serials of
+	// its slots keep invalidating stale handles
+	TUniquePtr<GameplayTagManager::FTagContributionArena> ContributionArena;
+
 	bool bHasChangedAnything = false;
+	bool bCompactStorage = false;
 
 	TWeakObjectPtr<UActorComponent> Owner = nullptr;
-	FString Type;
+	EGTM_StackContainerId ContainerId = EGTM_StackContainerId::Loose;
+};
+
+/**
+ * Container of gameplay tag stacks that never replicates. Keeps its first few stacks inline, sparing the actors that
+ * only hold a handful of tags the heap allocation of the stack array.
+ */
+struct FGTM_LocalTagStackContainer
+	: public FGTM_GameplayTagStackContainer
+{
+public:
+	FGTM_LocalTagStackContainer();
+	FGTM_LocalTagStackContainer(UActorComponent* InOwner, EGTM_StackContainerId InContainerId);
+	FGTM_LocalTagStackContainer(const FGTM_LocalTagStackContainer& Other);
+	FGTM_LocalTagStackContainer& operator=(const FGTM_LocalTagStackContainer& Other);
+
+private:
+	GameplayTagManager::FLocalTagStackArray InlineStacks;
 };
 
 template<>
@@ -0,0 +1,174 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectMacros.h"
+
+#include "GTM_GameplayTagTypes.generated.h"
+
+/**
+ * Replication channel a replicated tag is routed to. Routing is configured per tag subtree in the project settings.
+ */
+UENUM(BlueprintType)
+enum class EGTM_ReplicationChannel : uint8
+{
+	/** Replicated to everyone. */
+	Default,
+
+	/** Replicated to the owning connection only. */
+	OwnerOnly,
+
+	/** Replicated using the condition configured in the project settings. */
+	Custom,
+};
+
+/**
+ * Lifetime conditions that can be assigned to the custom replication channel.
+ */
+UENUM(BlueprintType)
+enum class EGTM_ReplicationCondition : uint8
+{
+	/** Replicated to everyone. */
+	None,
+
+	/** Replicated to the owning connection only. */
+	OwnerOnly,
+
+	/** Replicated to everyone but the owning connection. */
+	SkipOwner,
+
+	/** Replicated to simulated proxies only. */
+	SimulatedOnly,
+
+	/** Replicated to autonomous proxy only. */
+	AutonomousOnly,
+
+	/** Replicated only while the channel is activated via UGameplayTagManager::SetCustomReplicationChannelActive. */
+	Custom,
+};
+
+/**
+ * Kind of change applied to a tag stack.
+ */
+UENUM(BlueprintType)
+enum class EGTM_TagMutationType : uint8
+{
+	/** Adds the count to the stack. */
+	Add,
+
+	/** Removes the count from the stack. */
+	Remove,
+
+	/** Sets the stack to the count. */
+	Override,
+};
+
+/**
+ * Kind of tags an operation is applied to.
+ */
+UENUM(BlueprintType)
+enum class EGTM_TagContainerType : uint8
+{
+	Replicated,
+	Loose,
+	Authoritative,
+};
+
+/**
+ * Identifies one of the stack containers a manager holds. Replicated tags are split across several containers, one
+ * per replication channel.
+ */
+UENUM()
+enum class EGTM_StackContainerId : uint8
+{
+	Replicated,
+	OwnerOnly,
+	Custom,
+	Loose,
+	Authoritative,
+	Num UMETA(Hidden),
+};
+
+GAMEPLAYTAGMANAGER_API const TCHAR* LexToString(EGTM_StackContainerId ContainerId);
+
+/**
+ * Memory used by a gameplay tag manager, broken down by part. Everything is in bytes; Object is the size of the
+ * component itself, the rest is heap memory owned by it.
+ */
+struct GAMEPLAYTAGMANAGER_API FGTM_TagManagerMemoryUsage
+{
+public:
+	SIZE_T GetTotal() const;
+
+	FGTM_TagManagerMemoryUsage& operator+=(const FGTM_TagManagerMemoryUsage& Other);
+
+public:
+	SIZE_T Object = 0;
+	SIZE_T Containers[static_cast<int32>(EGTM_StackContainerId::Num)] = { };
+	SIZE_T CachedTags = 0;
+	SIZE_T Listeners = 0;
+	SIZE_T Events = 0;
+};
+
+namespace GameplayTagManager
+{
+	/** Returns the heap memory used by the container. Parent tags aren't exposed, so their share is estimated. */
+	GAMEPLAYTAGMANAGER_API SIZE_T GetAllocatedSize(const FGameplayTagContainer& Container);
+}
+
+/**
+ * Single change to apply to a manager's tags as part of a batch.
+ */
+USTRUCT(BlueprintType)
+struct GAMEPLAYTAGMANAGER_API FGTM_TagOperation
+{
+	GENERATED_BODY()
+
+public:
+	FGTM_TagOperation() = default;
+	FGTM_TagOperation(FGameplayTag InTag, EGTM_TagMutationType InMutation, int32 InCount = 1,
+		EGTM_TagContainerType InContainer = EGTM_TagContainerType::Replicated);
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Gameplay Tags")
+	FGameplayTag Tag;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Gameplay Tags")
+	EGTM_TagMutationType Mutation = EGTM_TagMutationType::Add;
+
+	/** Amount of stacks to add or remove, or the count to override with. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Gameplay Tags", meta=(ClampMin="0"))
+	int32 Count = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Gameplay Tags")
+	EGTM_TagContainerType Container = EGTM_TagContainerType::Replicated;
+};
+
+/**
+ * Identifies stacks added on behalf of a source, see UGameplayTagManager::AddTagContribution. Stale handles are
+ * detected, so removing through one twice does nothing.
+ */
+USTRUCT(BlueprintType)
+struct GAMEPLAYTAGMANAGER_API FGTM_TagContributionHandle
+{
+	GENERATED_BODY()
+
+public:
+	FGTM_TagContributionHandle() = default;
+	FGTM_TagContributionHandle(int32 InIndex, uint16 InSerial, EGTM_StackContainerId InContainerId);
+
+	bool IsValid() const;
+
+	bool operator==(const FGTM_TagContributionHandle& Rhs) const;
+	friend uint32 GetTypeHash(const FGTM_TagContributionHandle& Handle);
+
+public:
+	/** Slot in the container's contribution arena. */
+	int32 Index = INDEX_NONE;
+
+	/** Changes every time the slot is freed, invalidating the handles to it. */
+	uint16 Serial = 0;
+
+	EGTM_StackContainerId ContainerId = EGTM_StackContainerId::Loose;
+};
@@ -0,0 +1,45 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "Containers/StaticArray.h"
+#include "GameplayTagContainer.h"
+
+/**
+ * Fixed-size ring buffer of tag changes predicted by the autonomous proxy and waiting for server's verdict.
+ *
+ * Each entry keeps the change it applied to the local stack count, so a rejected prediction can be undone
+ * without touching any other tag. Entries that are overwritten before the server replies are considered confirmed.
+ */
+struct GAMEPLAYTAGMANAGER_API FGTM_TagPredictionHistory
+{
+public:
+	struct FEntry
+	{
+	public:
+		FGameplayTag Tag;
+
+		/** Difference applied to the local stack count by the prediction. */
+		int32 Delta = 0;
+
+		uint16 Key = 0;
+		bool bPending = false;
+	};
+
+	static constexpr int32 Capacity = 32;
+
+public:
+	/** Records a new prediction and returns the key the server has to reply with. */
+	uint16 Record(FGameplayTag Tag, int32 Delta);
+
+	/** Removes the pending prediction matching the key. Returns false if it was already evicted. */
+	bool Consume(uint16 Key, FEntry& OutEntry);
+
+	void Reset();
+
+private:
+	TStaticArray<FEntry, Capacity> Entries;
+
+	/** Key 0 is never handed out to make uninitialized keys invalid. */
+	uint16 NextKey = 1;
+};
@@ -1,9 +1,11 @@
-// Author: Antonio Sidenko (Tonetfal), June 2025
+﻿// Author: Antonio Sidenko (Tonetfal), June 2025
 
 #pragma once
 
 #include "GameplayTagContainer.h"
 #include "Gameplay/Misc/GTM_GameplayTagStackContainer.h"
+#include "Gameplay/Misc/GTM_GameplayTagTypes.h"
+#include "Gameplay/Misc/GTM_TagPredictionHistory.h"
 
 #if ENABLE_DRAW_DEBUG
 #include "Debug/GTM_ShowDebug.h"
@@ -23,12 +25,14 @@ struct FAutoCompleteCommand;
  * It presents Replicated, Loose and Authoritative tags you can add/remove.
  *
  * - Replicated tags: can be only changed server-side,
- *		and will be automatically replicated to everyone.
+ *		and will be automatically replicated to everyone. Tag subtrees can be routed to the owner-only or
+ *		the custom replication channel via project settings.
  *
  * - Loose tags: can be changed by anyone, and will never replicate.
  *
  * - Authoritative tags: can be only changed by server or autonomous proxy,
- *		and will be only replicated to simulated proxies. Useful for prediction.
+ *		and will be only replicated to simulated proxies. Useful for prediction. Optionally the autonomous proxy's
+ *		changes can be sent to the server, which confirms or rejects them; rejected changes are rolled back.
  *
  * All tags are uniformly advertised as "Tags". You can query or listen for tags changes no matter their nature.
  *
@@ -36,6 +40,9 @@ struct FAutoCompleteCommand;
  *
  * Regardless the amount of a given tag in any type, "Tags" and delegates will only fire when
  * that tag makes its first appearance or gets removed entirely from every single type.
+ *
+ * Event tags are one-shot notifications that are never stored. Events sent server-side are additionally
+ * delivered to clients, batched into a single unreliable multicast per net update.
  */
 UCLASS(Category="Gameplay", meta=(BlueprintSpawnableComponent))
 class GAMEPLAYTAGMANAGER_API UGameplayTagManager
@@ -43,6 +50,9 @@ class GAMEPLAYTAGMANAGER_API UGameplayTagManager
 {
 	GENERATED_BODY()
 
+	// Splits bulk operations into the parallel mutation and the game thread flush
+	friend class UGTM_GameplayTagManagerSubsystem;
+
 public:
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(
 		FOnTagsChangedSignature,
@@ -56,6 +66,13 @@ public:
 		FGameplayTagContainer AddedTags,
 		FGameplayTagContainer RemovedTags);
 
+	DECLARE_MULTICAST_DELEGATE_FourParams(
+		FOnTagCountChangedSimpleSignature,
+		UGameplayTagManager* Manager,
+		FGameplayTag Tag,
+		int32 OldCount,
+		int32 NewCount);
+
 	DECLARE_DYNAMIC_DELEGATE_ThreeParams(
 		FOnTagChangedSignature,
 		UGameplayTagManager*, Manager,
@@ -80,6 +97,34 @@ public:
 		FGameplayTag Tag,
 		bool bIsPresent);
 
+	DECLARE_DYNAMIC_DELEGATE_TwoParams(
+		FOnEventTagSignature,
+		UGameplayTagManager*, Manager,
+		FGameplayTag, EventTag);
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
+		FOnEventTagMulticastSignature,
+		UGameplayTagManager*, Manager,
+		FGameplayTag, EventTag);
+
+	DECLARE_DELEGATE_TwoParams(
+		FOnEventTagSimpleSignature,
+		UGameplayTagManager* Manager,
+		FGameplayTag EventTag);
+
+	DECLARE_MULTICAST_DELEGATE_TwoParams(
+		FOnEventTagMulticastSimpleSignature,
+		UGameplayTagManager* Manager,
+		FGameplayTag EventTag);
+
+	DECLARE_DELEGATE_RetVal_FourParams(
+		bool,
+		FValidatePredictedTagSignature,
+		UGameplayTagManager* Manager,
+		FGameplayTag Tag,
+		EGTM_TagMutationType Mutation,
+		int32 Count);
+
 public:
 	UGameplayTagManager(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
@@ -90,8 +135,18 @@ public:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 	virtual void InitializeComponent() override;
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
 	//~End of UActorComponent Interface
 
+	//~UObject Interface
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+	//~End of UObject Interface
+
+	/** Returns the memory used by this manager, broken down by part. See the gtm.MemReport console command. */
+	FGTM_TagManagerMemoryUsage GetMemoryUsage() const;
+
 	UFUNCTION(BlueprintPure, Category="Gameplay Tags", meta=(BlueprintThreadSafe))
 	FGameplayTagContainer GetTags() const;
 
@@ -121,6 +176,44 @@ public:
 	FDelegateHandle BindGameplayTagListener(FOnTagChangedSimpleSignature Delegate, FGameplayTag Tag);
 	void UnbindGameplayTagListener(FDelegateHandle Handle);
 
+	/**
+	 * Binds a listener called with the old and new count whenever the count of exactly this tag changes. Unlike
+	 * OnTagCountChangedSimpleDelegate, only the changes of this tag are looked at.
+	 */
+	FDelegateHandle BindTagCountListener(FOnTagCountChangedSimpleSignature::FDelegate Delegate, FGameplayTag Tag);
+	void UnbindTagCountListener(FDelegateHandle Handle);
+
+	/**
+	 * Applies all the operations in order, with a single notification and a single dirty mark per changed container.
+	 * Use UGTM_GameplayTagManagerSubsystem::ApplyBulkTagOperations to apply them on many managers at once.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Gameplay Tags")
+	void ApplyTagOperations(const TArray<FGTM_TagOperation>& Operations);
+
+	/** Whether bulk operations may apply this manager's changes on worker threads. Never if it predicts tags. */
+	bool AllowsParallelBulkMutation() const;
+
+	/** World time of the last tag notification, i.e. the last time any count changed. */
+	double GetLastTagChangeTime() const;
+
+#pragma region Events
+	/**
+	 * Fires listeners of the event tag without storing it. If sent server-side with bReplicate set,
+	 * the event is also delivered to clients with the next net update. Duplicates within an update are merged.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Gameplay Tags|Events", meta=(AdvancedDisplay="bReplicate"))
+	void SendEventTag(FGameplayTag EventTag, bool bReplicate = true);
+
+	UFUNCTION(BlueprintCallable, Category="Gameplay Tags|Events", meta=(Keywords="add assign event"))
+	void BindEventTagListener(UPARAM(DisplayName="Event") FOnEventTagSignature Delegate, FGameplayTag EventTag);
+
+	UFUNCTION(BlueprintCallable, Category="Gameplay Tags|Events", meta=(Keywords="remove unassign event"))
+	void UnbindEventTagListener(UPARAM(DisplayName="Event") FOnEventTagSignature Delegate, FGameplayTag EventTag);
+
+	FDelegateHandle BindEventTagListener(FOnEventTagSimpleSignature Delegate, FGameplayTag EventTag);
+	void UnbindEventTagListener(FDelegateHandle Handle);
+#pragma endregion
+
 #pragma region Replicated
 	UFUNCTION(BlueprintPure, Category="Gameplay Tags|Replicated", meta=(BlueprintThreadSafe))
 	FGameplayTagContainer GetReplicatedTags() const;
@@ -157,6 +250,10 @@ public:
 
 	UFUNCTION(BlueprintAuthorityOnly, BlueprintCallable, Category="Gameplay Tags|Replicated")
 	void ChangeTags(FGameplayTagContainer Tags, bool bAdd);
+
+	/** Activates or deactivates the custom replication channel. Only relevant if it uses the Custom condition. */
+	UFUNCTION(BlueprintAuthorityOnly, BlueprintCallable, Category="Gameplay Tags|Replicated")
+	void SetCustomReplicationChannelActive(bool bActive);
 #pragma endregion
 
 #pragma region Loose
@@ -233,9 +330,106 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category="Gameplay Tags|Authoritative")
 	void ChangeAuthoritativeTags(FGameplayTagContainer Tags, bool bAdd);
+
+private:
+	bool ShouldPredictAuthoritativeTags() const;
+	void PredictAuthoritativeTag(FGameplayTag Tag, EGTM_TagMutationType Mutation, int32 Count);
+
+	UFUNCTION(Server, Reliable)
+	void ServerPredictAuthoritativeTag(uint16 PredictionKey, FGameplayTag Tag, EGTM_TagMutationType Mutation,
+		int32 Count);
+
+	UFUNCTION(Client, Reliable)
+	void ClientConfirmPredictedTag(uint16 PredictionKey);
+
+	UFUNCTION(Client, Reliable)
+	void ClientRejectPredictedTag(uint16 PredictionKey);
+#pragma endregion
+
+public:
+#pragma region Contributions
+	/**
+	 * Adds stacks on behalf of the source, which must be valid. Removing them through the returned handle takes away
+	 * exactly these stacks, no matter who else added to the tag. Overriding, clearing or removing the tag below what's
+	 * contributed shrinks the newest contributions first, and the handles of those left without stacks go stale.
+	 * Only the resulting count is replicated. Predicted authoritative tags aren't supported.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Gameplay Tags|Contributions", meta=(AdvancedDisplay="Count"))
+	FGTM_TagContributionHandle AddTagContribution(FGameplayTag Tag, const UObject* Source,
+		EGTM_TagContainerType ContainerType = EGTM_TagContainerType::Loose, int32 Count = 1);
+
+	/** Removes the stacks of the contribution. Returns false if it was already removed. */
+	UFUNCTION(BlueprintCallable, Category="Gameplay Tags|Contributions")
+	bool RemoveTagContribution(FGTM_TagContributionHandle Handle);
+
+	/** Removes the stacks of every contribution of the source. */
+	UFUNCTION(BlueprintCallable, Category="Gameplay Tags|Contributions")
+	void RemoveTagContributions(const UObject* Source);
+
+	/** Returns the stacks of the tag contributed by the source. */
+	UFUNCTION(BlueprintPure, Category="Gameplay Tags|Contributions")
+	int32 GetTagContributionCount(FGameplayTag Tag, const UObject* Source) const;
 #pragma endregion
 
 private:
+	struct FListenerTables
+	{
+	public:
+		TMap<FGameplayTag, FOnTagChangedMulticastSignature> SingleListeners;
+		TMap<FGameplayTag, FOnTagChangedMulticastSimpleSignature> SingleSimpleListeners;
+
+		TMap<FGameplayTag, FOnEventTagMulticastSignature> EventListeners;
+		TMap<FGameplayTag, FOnEventTagMulticastSimpleSignature> EventSimpleListeners;
+
+		TMap<FGameplayTag, FOnTagCountChangedSimpleSignature> CountListeners;
+	};
+
+	/** Count of a tag as of the last notification, and its count since then. */
+	struct FPendingCountChange
+	{
+	public:
+		FGameplayTag Tag;
+		int32 OldCount = 0;
+		int32 NewCount = 0;
+	};
+
+	void BroadcastEventTag(FGameplayTag EventTag);
+
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastEventTags(const FGameplayTagContainer& EventTags);
+
+	/**
+	 * Applies the operations without marking anything dirty nor notifying anyone, see FlushPendingChanges. May run on
+	 * a worker thread if listeners allow it.
+	 */
+	void ApplyTagOperationsImpl(TConstArrayView<FGTM_TagOperation> Operations);
+
+	/** Marks the containers changed by ApplyTagOperationsImpl dirty and notifies the listeners. Game thread only. */
+	void FlushPendingChanges();
+	void MarkPendingContainersDirty();
+
+	EGTM_StackContainerId GetReplicatedContainerId(FGameplayTag Tag) const;
+
+	/** Returns false for the channels no route targets, which never hold any tags. */
+	bool IsContainerInUse(EGTM_StackContainerId ContainerId) const;
+	FGTM_GameplayTagStackContainer& GetContainer(EGTM_StackContainerId ContainerId);
+	const FGTM_GameplayTagStackContainer& GetContainer(EGTM_StackContainerId ContainerId) const;
+	FGTM_GameplayTagStackContainer& GetReplicatedContainer(FGameplayTag Tag);
+	const FGTM_GameplayTagStackContainer& GetReplicatedContainer(FGameplayTag Tag) const;
+	void MarkContainerDirty(EGTM_StackContainerId ContainerId);
+	void MarkReplicatedContainerDirty(FGameplayTag Tag);
+
+	/** Wakes the owner up if it's dormant, and keeps track of the activity to put it back to dormancy later. */
+	void FlushOwnerNetDormancy();
+	void ScheduleOwnerNetDormancy(float Delay);
+	void OnNetDormancyIdleTimeElapsed();
+
+	FListenerTables& GetOrCreateListenerTables();
+
+	/** Gathers the stack count changes for the count listeners, which are notified by NotifyTagsChanged. */
+	void OnStackCountChanged(FGameplayTag Tag, int32 OldCount, int32 NewCount);
+	bool HasCountListeners() const;
+
 	void NotifyTagsChanged();
 	void CacheTags();
 
@@ -248,30 +442,104 @@ public:
 	FOnTagsChangedSignature OnTagsChangedDelegate;
 	FOnTagsChangedSimpleSignature OnTagsChangeSimpleDelegate;
 
+	/** Called for every tag whose count changed since the last notification. Changes are only gathered while bound. */
+	FOnTagCountChangedSimpleSignature OnTagCountChangedSimpleDelegate;
+
+	/**
+	 * Server-side check of the authoritative tag changes predicted by the autonomous proxy. Rejected changes are
+	 * rolled back on the client. Every valid change is accepted if unbound.
+	 */
+	FValidatePredictedTagSignature ValidatePredictedTagDelegate;
+
+protected:
+	/**
+	 * If true, the server puts the owner to dormancy once replicated and authoritative tags haven't changed for
+	 * NetDormancyIdleTime seconds, and wakes it up right before they change again.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="Replication")
+	bool bDriveOwnerNetDormancy = false;
+
+	UPROPERTY(EditDefaultsOnly, Category="Replication",
+		meta=(EditCondition="bDriveOwnerNetDormancy", ClampMin="0", Units="Seconds"))
+	float NetDormancyIdleTime = 5.f;
+
+	/**
+	 * If true, authoritative tags changed by the autonomous proxy are applied locally right away and sent to the
+	 * server, which either confirms or rejects them.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="Replication")
+	bool bPredictAuthoritativeTags = false;
+
+	/**
+	 * Set if the stacks of this manager can be changed from worker threads. Allows bulk operations to process this
+	 * manager in parallel with others. Listeners, replication and RPCs are still handled on the game thread once the
+	 * work is done, so this is ignored while authoritative tags are predicted.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="Threading")
+	bool bAllowParallelBulkMutation = false;
+
+	/**
+	 * If true, tag containers don't keep their own tag to count map and tag container and scan their stacks instead,
+	 * at the cost of slower per-container queries. Stacks still live in one array per container, so only the memory
+	 * of those lookup structures is saved.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="Memory")
+	bool bCompactStorage = false;
+
 private:
 	/** Replicated to everyone. Changed server-side only. */
 	UPROPERTY(Replicated)
 	FGTM_GameplayTagStackContainer ReplicatedStateTagsContainer;
 
+	/** Replicated to owner only. Changed server-side only. Holds replicated tags routed to the owner-only channel. */
+	UPROPERTY(Replicated)
+	FGTM_GameplayTagStackContainer OwnerOnlyStateTagsContainer;
+
+	/**
+	 * Replicated using the project-defined condition. Changed server-side only. Holds replicated tags routed to
+	 * the custom channel.
+	 */
+	UPROPERTY(Replicated)
+	FGTM_GameplayTagStackContainer CustomStateTagsContainer;
+
 	/** Locally predicted. Not replicated at all. */
-	FGTM_GameplayTagStackContainer LooseStateTagsContainer;
+	FGTM_LocalTagStackContainer LooseStateTagsContainer;
 
 	/** Replicated to everyone but autonomous proxy. Autonomous proxy is changing that on its own. */
 	UPROPERTY(Replicated)
 	FGTM_GameplayTagStackContainer AuthoritativeStateTagsContainer;
 
 	/**
-	 * Global container that counts replicated, loose and authoritative tags all together
+	 * Global container that counts replicated (of every channel), loose and authoritative tags all together
 	 * making it quicker to query information down the line.
 	 */
 	TMap<FGameplayTag, int32> CachedTagsCount;
 	FGameplayTagContainer CachedTags;
 
-	TMap<FGameplayTag, FOnTagChangedMulticastSignature> SingleListeners;
-	TMap<FGameplayTag, FOnTagChangedMulticastSimpleSignature> SingleSimpleListeners;
+	/** Allocated on the first bind; most managers in a crowd are never listened to. */
+	TUniquePtr<FListenerTables> ListenerTables;
+
+	/** Tags whose count changed since the last notification. Only gathered while there are count listeners. */
+	TArray<FPendingCountChange> PendingCountChanges;
+
+	/** Event tags sent server-side since the last net update. */
+	FGameplayTagContainer PendingEventTags;
 	FGameplayTagContainer LastKnownTags;
 
-#if ENABLE_DRAW_DEBUG
-	GameplayTagManager::FGTM_ShowDebug ShowDebugObj;
-#endif
+	/** Authoritative tag changes predicted by the autonomous proxy that the server hasn't replied to yet. */
+	FGTM_TagPredictionHistory PredictionHistory;
+
+	FTimerHandle NetDormancyTimerHandle;
+	double LastReplicatedTagsChangeTime = 0.0;
+	double LastTagChangeTime = 0.0;
+
+	/** While positive, notifications are deferred until the outermost batch ends. */
+	int32 NotificationBatchDepth = 0;
+	bool bHasPendingNotification = false;
+
+	/** Bit mask of EGTM_StackContainerId changed by a batch that yet have to be marked dirty. */
+	uint8 PendingDirtyContainers = 0;
+
+	/** Slot in the registry of UGTM_GameplayTagManagerSubsystem while registered. */
+	int32 RegistryIndex = INDEX_NONE;
 };
@@ -0,0 +1,78 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "Engine/DeveloperSettings.h"
+#include "GameplayTagContainer.h"
+#include "Gameplay/Misc/GTM_GameplayTagTypes.h"
+#include "UObject/CoreNetTypes.h"
+
+#include "GTM_GameplayTagManagerSettings.generated.h"
+
+/**
+ * Routes a tag subtree to a replication channel.
+ */
+USTRUCT()
+struct GAMEPLAYTAGMANAGER_API FGTM_ReplicationChannelRoute
+{
+	GENERATED_BODY()
+
+public:
+	/** Root of the subtree being routed. The most specific root matching a tag wins. */
+	UPROPERTY(EditAnywhere, Config, Category="Replication")
+	FGameplayTag TagRoot;
+
+	/** Channel the tags of the subtree will replicate through. */
+	UPROPERTY(EditAnywhere, Config, Category="Replication")
+	EGTM_ReplicationChannel Channel = EGTM_ReplicationChannel::Default;
+};
+
+/**
+ * Project-wide settings of the Gameplay Tag Manager.
+ */
+UCLASS(Config=Game, DefaultConfig, DisplayName="Gameplay Tag Manager")
+class GAMEPLAYTAGMANAGER_API UGTM_GameplayTagManagerSettings
+	: public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UGTM_GameplayTagManagerSettings();
+
+	static const UGTM_GameplayTagManagerSettings* Get();
+
+	/** Returns the channel a replicated tag has to be routed to. Safe to call from any thread. */
+	EGTM_ReplicationChannel GetReplicationChannel(FGameplayTag Tag) const;
+
+	/** Returns true if at least one route targets the channel. The default channel is always in use. */
+	bool IsChannelRouted(EGTM_ReplicationChannel Channel) const;
+
+	/** Returns the lifetime condition the custom channel is registered with. */
+	ELifetimeCondition GetCustomChannelLifetimeCondition() const;
+
+	//~UObject Interface
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~End of UObject Interface
+
+public:
+	/**
+	 * Routes of replicated tags to additional replication channels. Tags that don't match any route
+	 * replicate through the default channel, which is replicated to everyone. Channels no route targets are
+	 * never replicated, which is decided once per class, so routing to a new channel requires a restart.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category="Replication")
+	TArray<FGTM_ReplicationChannelRoute> ReplicationChannelRoutes;
+
+	/**
+	 * Condition the custom channel is replicated with. Read once per class when replicated properties are
+	 * registered, so changing it requires a restart.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category="Replication")
+	EGTM_ReplicationCondition CustomChannelCondition = EGTM_ReplicationCondition::Custom;
+
+private:
+	mutable TMap<FGameplayTag, EGTM_ReplicationChannel> CachedReplicationChannels;
+	mutable FRWLock CachedReplicationChannelsLock;
+};
@@ -0,0 +1,31 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+using UnrealBuildTool;
+
+public class GameplayTagManagerAI : ModuleRules
+{
+	public GameplayTagManagerAI(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"AIModule",
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"GameplayTags",
+				"StateTreeModule",
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"GameplayTagManager",
+				"GameplayTasks",
+			}
+		);
+	}
+}
@@ -0,0 +1,172 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "AI/GTM_BTDecorator_TagCheck.h"
+
+#include "AIController.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "BehaviorTree/BlackboardComponent.h"
+#include "BehaviorTree/Blackboard/BlackboardKeyType_Object.h"
+#include "Gameplay/Misc/GameplayTagManager.h"
+
+UGTM_BTDecorator_TagCheck::UGTM_BTDecorator_TagCheck()
+{
+	NodeName = TEXT("Gameplay Tag Manager: Tag Check");
+
+	bNotifyBecomeRelevant = true;
+	bNotifyCeaseRelevant = true;
+
+	ActorToCheck.AddObjectFilter(this, GET_MEMBER_NAME_CHECKED(ThisClass, ActorToCheck), AActor::StaticClass());
+	ActorToCheck.AllowNoneAsValue(true);
+}
+
+void UGTM_BTDecorator_TagCheck::InitializeFromAsset(UBehaviorTree& Asset)
+{
+	Super::InitializeFromAsset(Asset);
+
+	if (const UBlackboardData* BlackboardAsset = GetBlackboardAsset())
+	{
+		ActorToCheck.ResolveSelectedKey(*BlackboardAsset);
+	}
+}
+
+uint16 UGTM_BTDecorator_TagCheck::GetInstanceMemorySize() const
+{
+	return sizeof(FNodeMemory);
+}
+
+void UGTM_BTDecorator_TagCheck::InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory,
+	EBTMemoryInit::Type InitType) const
+{
+	InitializeNodeMemory<FNodeMemory>(NodeMemory, InitType);
+}
+
+void UGTM_BTDecorator_TagCheck::CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory,
+	EBTMemoryClear::Type CleanupType) const
+{
+	CleanupNodeMemory<FNodeMemory>(NodeMemory, CleanupType);
+}
+
+FString UGTM_BTDecorator_TagCheck::GetStaticDescription() const
+{
+	const FString ActorName = ActorToCheck.IsSet() ? ActorToCheck.SelectedKeyName.ToString() : TEXT("Pawn");
+	return FString::Printf(TEXT("%s: %s on %s"), *Super::GetStaticDescription(), *TagCheck.GetDescription(),
+		*ActorName);
+}
+
+bool UGTM_BTDecorator_TagCheck::CalculateRawConditionValue(UBehaviorTreeComponent& OwnerComp,
+	uint8* NodeMemory) const
+{
+	return TagCheck.Evaluate(FindGameplayTagManager(OwnerComp));
+}
+
+void UGTM_BTDecorator_TagCheck::OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	// The actor to check may change while relevant, which switches the manager to listen to
+	UBlackboardComponent* BlackboardComp = OwnerComp.GetBlackboardComponent();
+	if (ActorToCheck.IsSet() && BlackboardComp)
+	{
+		BlackboardComp->RegisterObserver(ActorToCheck.GetSelectedKeyID(), this,
+			FOnBlackboardChangeNotification::CreateUObject(this, &ThisClass::OnBlackboardKeyValueChange));
+	}
+
+	BindToManager(OwnerComp, *CastInstanceNodeMemory<FNodeMemory>(NodeMemory));
+}
+
+void UGTM_BTDecorator_TagCheck::OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	if (UBlackboardComponent* BlackboardComp = OwnerComp.GetBlackboardComponent())
+	{
+		BlackboardComp->UnregisterObserversFrom(this);
+	}
+
+	UnbindFromManager(*CastInstanceNodeMemory<FNodeMemory>(NodeMemory));
+}
+
+UGameplayTagManager* UGTM_BTDecorator_TagCheck::FindGameplayTagManager(const UBehaviorTreeComponent& OwnerComp) const
+{
+	const AActor* Actor = nullptr;
+	if (ActorToCheck.IsSet())
+	{
+		const UBlackboardComponent* BlackboardComp = OwnerComp.GetBlackboardComponent();
+		Actor = BlackboardComp
+			? Cast<AActor>(BlackboardComp->GetValue<UBlackboardKeyType_Object>(ActorToCheck.GetSelectedKeyID()))
+			: nullptr;
+	}
+	else if (const AAIController* AIController = OwnerComp.GetAIOwner())
+	{
+		Actor = AIController->GetPawn();
+	}
+
+	return Actor ? UGameplayTagManager::Get(Actor) : nullptr;
+}
+
+void UGTM_BTDecorator_TagCheck::BindToManager(UBehaviorTreeComponent& OwnerComp, FNodeMemory& Memory)
+{
+	UGameplayTagManager* Manager = FindGameplayTagManager(OwnerComp);
+	if (!IsValid(Manager))
+	{
+		return;
+	}
+
+	Memory.Manager = Manager;
+	Memory.DelegateHandle = Manager->OnTagsChangeSimpleDelegate.AddUObject(this, &ThisClass::OnTagsChanged,
+		TWeakObjectPtr<UBehaviorTreeComponent>(&OwnerComp));
+}
+
+void UGTM_BTDecorator_TagCheck::UnbindFromManager(FNodeMemory& Memory)
+{
+	if (UGameplayTagManager* Manager = Memory.Manager.Get())
+	{
+		Manager->OnTagsChangeSimpleDelegate.Remove(Memory.DelegateHandle);
+	}
+
+	Memory.Manager = nullptr;
+	Memory.DelegateHandle.Reset();
+}
+
+EBlackboardNotificationResult UGTM_BTDecorator_TagCheck::OnBlackboardKeyValueChange(
+	const UBlackboardComponent& Blackboard, FBlackboard::FKey ChangedKeyID)
+{
+	auto* OwnerComp = Cast<UBehaviorTreeComponent>(Blackboard.GetBrainComponent());
+	if (!OwnerComp)
+	{
+		return EBlackboardNotificationResult::RemoveObserver;
+	}
+
+	if (ChangedKeyID != ActorToCheck.GetSelectedKeyID())
+	{
+		return EBlackboardNotificationResult::ContinueObserving;
+	}
+
+	uint8* NodeMemory = OwnerComp->GetNodeMemory(this, OwnerComp->FindInstanceContainingNode(this));
+	if (!NodeMemory)
+	{
+		return EBlackboardNotificationResult::ContinueObserving;
+	}
+
+	auto& Memory = *CastInstanceNodeMemory<FNodeMemory>(NodeMemory);
+	UnbindFromManager(Memory);
+	BindToManager(*OwnerComp, Memory);
+
+	// The new actor's tags may give a different result
+	ConditionalFlowAbort(*OwnerComp, EBTDecoratorAbortRequest::ConditionResultChanged);
+	return EBlackboardNotificationResult::ContinueObserving;
+}
+
+void UGTM_BTDecorator_TagCheck::OnTagsChanged(UGameplayTagManager* Manager, FGameplayTagContainer AddedTags,
+	FGameplayTagContainer RemovedTags, TWeakObjectPtr<UBehaviorTreeComponent> WeakOwnerComp)
+{
+	UBehaviorTreeComponent* OwnerComp = WeakOwnerComp.Get();
+	if (!OwnerComp)
+	{
+		return;
+	}
+
+	if (!TagCheck.IsAffectedBy(AddedTags) && !TagCheck.IsAffectedBy(RemovedTags))
+	{
+		return;
+	}
+
+	// Re-evaluates the condition and aborts only if the result and the abort mode call for it
+	ConditionalFlowAbort(*OwnerComp, EBTDecoratorAbortRequest::ConditionResultChanged);
+}
@@ -0,0 +1,82 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "AI/GTM_StateTreeTagNodes.h"
+
+#include "Gameplay/Misc/GameplayTagManager.h"
+#include "StateTreeExecutionContext.h"
+
+namespace
+{
+	UGameplayTagManager* FindGameplayTagManager(const AActor* Actor)
+	{
+		return IsValid(Actor) ? UGameplayTagManager::Get(Actor) : nullptr;
+	}
+}
+
+bool FGTM_StateTreeTagCondition::TestCondition(FStateTreeExecutionContext& Context) const
+{
+	const FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+	const UGameplayTagManager* Manager = FindGameplayTagManager(InstanceData.Actor);
+	return TagCheck.Evaluate(Manager) ^ bInvert;
+}
+
+void FGTM_StateTreeTagEvaluator::TreeStart(FStateTreeExecutionContext& Context) const
+{
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+	InstanceData.bIsDirty = MakeShared<bool>(false);
+
+	UGameplayTagManager* Manager = FindGameplayTagManager(InstanceData.Actor);
+	InstanceData.bMatches = TagCheck.Evaluate(Manager);
+	if (!IsValid(Manager))
+	{
+		return;
+	}
+
+	// The tree's node data is immutable and shared, so the listener captures copies instead of this node
+	InstanceData.Manager = Manager;
+	InstanceData.DelegateHandle = Manager->OnTagsChangeSimpleDelegate.AddLambda(
+		[TagCheck = TagCheck, bIsDirty = InstanceData.bIsDirty](UGameplayTagManager*, FGameplayTagContainer AddedTags,
+			FGameplayTagContainer RemovedTags)
+		{
+			if (TagCheck.IsAffectedBy(AddedTags) || TagCheck.IsAffectedBy(RemovedTags))
+			{
+				*bIsDirty = true;
+			}
+		});
+}
+
+void FGTM_StateTreeTagEvaluator::TreeStop(FStateTreeExecutionContext& Context) const
+{
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+	if (UGameplayTagManager* Manager = InstanceData.Manager.Get())
+	{
+		Manager->OnTagsChangeSimpleDelegate.Remove(InstanceData.DelegateHandle);
+	}
+
+	InstanceData.Manager = nullptr;
+	InstanceData.DelegateHandle.Reset();
+	InstanceData.bIsDirty.Reset();
+}
+
+void FGTM_StateTreeTagEvaluator::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+	if (!InstanceData.bIsDirty.IsValid() || !*InstanceData.bIsDirty)
+	{
+		return;
+	}
+
+	*InstanceData.bIsDirty = false;
+
+	const bool bMatches = TagCheck.Evaluate(InstanceData.Manager.Get());
+	if (bMatches == InstanceData.bMatches)
+	{
+		return;
+	}
+
+	InstanceData.bMatches = bMatches;
+	if (ChangedEventTag.IsValid())
+	{
+		Context.SendEvent(ChangedEventTag);
+	}
+}
@@ -0,0 +1,73 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "AI/GTM_TagCheck.h"
+
+#include "Gameplay/Misc/GameplayTagManager.h"
+
+bool FGTM_TagCheck::Evaluate(const UGameplayTagManager* Manager) const
+{
+	if (!IsValid(Manager))
+	{
+		return false;
+	}
+
+	if (Mode == EGTM_TagCheckMode::Exact)
+	{
+		// Exact checks don't need the tag hierarchy, so the counts are enough and nothing is copied
+		const TMap<FGameplayTag, int32>& TagsToCount = Manager->GetTagsToCount();
+		for (const FGameplayTag& Tag : Tags)
+		{
+			if (TagsToCount.Contains(Tag) != bRequireAll)
+			{
+				return !bRequireAll;
+			}
+		}
+
+		return bRequireAll;
+	}
+
+	const FGameplayTagContainer OwnedTags = Manager->GetTags();
+	if (Mode == EGTM_TagCheckMode::Query)
+	{
+		return Query.Matches(OwnedTags);
+	}
+
+	return bRequireAll ? OwnedTags.HasAll(Tags) : OwnedTags.HasAny(Tags);
+}
+
+bool FGTM_TagCheck::IsAffectedBy(const FGameplayTagContainer& ChangedTags) const
+{
+	switch (Mode)
+	{
+		case EGTM_TagCheckMode::Exact:
+			return ChangedTags.HasAnyExact(Tags);
+		case EGTM_TagCheckMode::Hierarchical:
+			return ChangedTags.HasAny(Tags);
+		case EGTM_TagCheckMode::Query:
+			// Query expressions match tags hierarchically
+			for (const FGameplayTag& QueryTag : Query.GetGameplayTagArray())
+			{
+				if (ChangedTags.HasTag(QueryTag))
+				{
+					return true;
+				}
+			}
+
+			return false;
+	}
+
+	return true;
+}
+
+FString FGTM_TagCheck::GetDescription() const
+{
+	if (Mode == EGTM_TagCheckMode::Query)
+	{
+		const FString QueryDescription = Query.GetDescription();
+		return QueryDescription.IsEmpty() ? TEXT("Query: (empty)") : FString::Printf(TEXT("Query: %s"),
+			*QueryDescription);
+	}
+
+	return FString::Printf(TEXT("%s %s: %s"), bRequireAll ? TEXT("All") : TEXT("Any"),
+		Mode == EGTM_TagCheckMode::Exact ? TEXT("exact") : TEXT("hierarchical"), *Tags.ToStringSimple());
+}
@@ -0,0 +1,5 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, GameplayTagManagerAI)
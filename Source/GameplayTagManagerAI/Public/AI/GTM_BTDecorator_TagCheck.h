@@ -0,0 +1,71 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "AI/GTM_TagCheck.h"
+#include "BehaviorTree/BehaviorTreeTypes.h"
+#include "BehaviorTree/BTDecorator.h"
+
+#include "GTM_BTDecorator_TagCheck.generated.h"
+
+class UGameplayTagManager;
+
+/**
+ * Checks the tags of an actor's gameplay tag manager. Instead of being polled, it listens to the manager while
+ * relevant and requests an abort only when a tag that can change its result is added or removed, or when the actor
+ * to check changes.
+ */
+UCLASS(DisplayName="Gameplay Tag Manager: Tag Check")
+class GAMEPLAYTAGMANAGERAI_API UGTM_BTDecorator_TagCheck
+	: public UBTDecorator
+{
+	GENERATED_BODY()
+
+private:
+	struct FNodeMemory
+	{
+	public:
+		TWeakObjectPtr<UGameplayTagManager> Manager;
+		FDelegateHandle DelegateHandle;
+	};
+
+public:
+	UGTM_BTDecorator_TagCheck();
+
+	//~UBTNode Interface
+	virtual void InitializeFromAsset(UBehaviorTree& Asset) override;
+	virtual uint16 GetInstanceMemorySize() const override;
+	virtual void InitializeMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory,
+		EBTMemoryInit::Type InitType) const override;
+	virtual void CleanupMemory(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory,
+		EBTMemoryClear::Type CleanupType) const override;
+	virtual FString GetStaticDescription() const override;
+	//~End of UBTNode Interface
+
+protected:
+	//~UBTDecorator Interface
+	virtual bool CalculateRawConditionValue(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const override;
+	virtual void OnBecomeRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+	virtual void OnCeaseRelevant(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+	//~End of UBTDecorator Interface
+
+private:
+	UGameplayTagManager* FindGameplayTagManager(const UBehaviorTreeComponent& OwnerComp) const;
+
+	/** Listens to the manager of the actor to check, if any. */
+	void BindToManager(UBehaviorTreeComponent& OwnerComp, FNodeMemory& Memory);
+	void UnbindFromManager(FNodeMemory& Memory);
+
+	EBlackboardNotificationResult OnBlackboardKeyValueChange(const UBlackboardComponent& Blackboard,
+		FBlackboard::FKey ChangedKeyID);
+	void OnTagsChanged(UGameplayTagManager* Manager, FGameplayTagContainer AddedTags,
+		FGameplayTagContainer RemovedTags, TWeakObjectPtr<UBehaviorTreeComponent> WeakOwnerComp);
+
+protected:
+	/** Actor whose manager is checked. The controlled pawn if not set. */
+	UPROPERTY(EditAnywhere, Category="Gameplay Tags")
+	FBlackboardKeySelector ActorToCheck;
+
+	UPROPERTY(EditAnywhere, Category="Gameplay Tags", meta=(ShowOnlyInnerProperties))
+	FGTM_TagCheck TagCheck;
+};
@@ -0,0 +1,107 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "AI/GTM_TagCheck.h"
+#include "StateTreeConditionBase.h"
+#include "StateTreeEvaluatorBase.h"
+
+#include "GTM_StateTreeTagNodes.generated.h"
+
+class UGameplayTagManager;
+
+USTRUCT()
+struct GAMEPLAYTAGMANAGERAI_API FGTM_StateTreeTagConditionInstanceData
+{
+	GENERATED_BODY()
+
+public:
+	/** Actor whose manager is checked. */
+	UPROPERTY(EditAnywhere, Category="Context")
+	TObjectPtr<AActor> Actor = nullptr;
+};
+
+/**
+ * Checks the tags of an actor's gameplay tag manager when the condition is tested. To avoid testing it every tick,
+ * pair it with an event transition fed by the tag check evaluator.
+ */
+USTRUCT(DisplayName="Gameplay Tag Manager: Tag Check")
+struct GAMEPLAYTAGMANAGERAI_API FGTM_StateTreeTagCondition
+	: public FStateTreeConditionCommonBase
+{
+	GENERATED_BODY()
+
+public:
+	using FInstanceDataType = FGTM_StateTreeTagConditionInstanceData;
+
+public:
+	//~FStateTreeNodeBase Interface
+	virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+	//~End of FStateTreeNodeBase Interface
+
+	//~FStateTreeConditionBase Interface
+	virtual bool TestCondition(FStateTreeExecutionContext& Context) const override;
+	//~End of FStateTreeConditionBase Interface
+
+public:
+	UPROPERTY(EditAnywhere, Category="Parameter", meta=(ShowOnlyInnerProperties))
+	FGTM_TagCheck TagCheck;
+
+	UPROPERTY(EditAnywhere, Category="Parameter")
+	bool bInvert = false;
+};
+
+USTRUCT()
+struct GAMEPLAYTAGMANAGERAI_API FGTM_StateTreeTagEvaluatorInstanceData
+{
+	GENERATED_BODY()
+
+public:
+	/** Actor whose manager is listened to. */
+	UPROPERTY(EditAnywhere, Category="Context")
+	TObjectPtr<AActor> Actor = nullptr;
+
+	/** Result of the tag check as of the last tick. */
+	UPROPERTY(VisibleAnywhere, Category="Output")
+	bool bMatches = false;
+
+	TWeakObjectPtr<UGameplayTagManager> Manager;
+	FDelegateHandle DelegateHandle;
+
+	/** Set by the manager's listener when a relevant tag changes. Shared since instance data can be relocated. */
+	TSharedPtr<bool> bIsDirty;
+};
+
+/**
+ * Listens to the tags of an actor's gameplay tag manager and exposes the result of a tag check. The check is only
+ * re-evaluated after a relevant tag changed, and an event can be sent whenever its result changes so that
+ * transitions don't need to test conditions every tick.
+ */
+USTRUCT(DisplayName="Gameplay Tag Manager: Tag Check Listener")
+struct GAMEPLAYTAGMANAGERAI_API FGTM_StateTreeTagEvaluator
+	: public FStateTreeEvaluatorCommonBase
+{
+	GENERATED_BODY()
+
+public:
+	using FInstanceDataType = FGTM_StateTreeTagEvaluatorInstanceData;
+
+public:
+	//~FStateTreeNodeBase Interface
+	virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+	//~End of FStateTreeNodeBase Interface
+
+	//~FStateTreeEvaluatorBase Interface
+	virtual void TreeStart(FStateTreeExecutionContext& Context) const override;
+	virtual void TreeStop(FStateTreeExecutionContext& Context) const override;
+	virtual void Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+	//~End of FStateTreeEvaluatorBase Interface
+
+public:
+	UPROPERTY(EditAnywhere, Category="Parameter", meta=(ShowOnlyInnerProperties))
+	FGTM_TagCheck TagCheck;
+
+	/** Sent whenever the result of the tag check changes. Nothing is sent if not set. */
+	UPROPERTY(EditAnywhere, Category="Parameter")
+	FGameplayTag ChangedEventTag;
+};
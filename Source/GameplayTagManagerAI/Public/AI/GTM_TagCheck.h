@@ -0,0 +1,60 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+
+#include "GTM_TagCheck.generated.h"
+
+class UGameplayTagManager;
+
+/**
+ * How the tags of a tag check are matched against the tags of a manager.
+ */
+UENUM(BlueprintType)
+enum class EGTM_TagCheckMode : uint8
+{
+	/** Tags must be present as they are. */
+	Exact,
+
+	/** Child tags satisfy their parents, e.g. A.B satisfies A. */
+	Hierarchical,
+
+	/** The tag query must match. */
+	Query,
+};
+
+/**
+ * Condition on the tags of a manager shared by the AI nodes. Knows which tag changes can affect its result, so that
+ * the nodes only re-evaluate it when one of those happens.
+ */
+USTRUCT(BlueprintType)
+struct GAMEPLAYTAGMANAGERAI_API FGTM_TagCheck
+{
+	GENERATED_BODY()
+
+public:
+	bool Evaluate(const UGameplayTagManager* Manager) const;
+
+	/** Returns whether the change of any of the tags can change the result. */
+	bool IsAffectedBy(const FGameplayTagContainer& ChangedTags) const;
+
+	FString GetDescription() const;
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tag Check")
+	EGTM_TagCheckMode Mode = EGTM_TagCheckMode::Exact;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tag Check",
+		meta=(EditCondition="Mode != EGTM_TagCheckMode::Query", EditConditionHides))
+	FGameplayTagContainer Tags;
+
+	/** Whether every tag is required, rather than any of them. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tag Check",
+		meta=(EditCondition="Mode != EGTM_TagCheckMode::Query", EditConditionHides))
+	bool bRequireAll = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Tag Check",
+		meta=(EditCondition="Mode == EGTM_TagCheckMode::Query", EditConditionHides))
+	FGameplayTagQuery Query;
+};
@@ -21,9 +21,14 @@ public class GameplayTagManagerEditor : ModuleRules
                 "CoreUObject",
                 "Engine",
                 "GameplayTagManager",
+                "GameplayTags",
                 "InputCore",
+                "Json",
+                "NetCore",
+                "Projects",
                 "Slate",
                 "SlateCore",
+                "UnrealEd",
             }
         );
     }
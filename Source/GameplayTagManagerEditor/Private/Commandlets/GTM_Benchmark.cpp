@@ -0,0 +1,346 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Commandlets/GTM_Benchmark.h"
+
+#include "Commandlets/GTM_CommandletUtils.h"
+#include "Dom/JsonObject.h"
+#include "Gameplay/Misc/GameplayTagManager.h"
+#include "Gameplay/Misc/GTM_GameplayTagStackContainer.h"
+#include "HAL/PlatformTime.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+	template<typename FuncType>
+	double MeasureNanosecondsPerOp(int32 Iterations, FuncType&& Func)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < Iterations; ++Index)
+		{
+			Func(Index);
+		}
+
+		return (FPlatformTime::Seconds() - StartTime) * 1e9 / Iterations;
+	}
+}
+
+namespace GameplayTagManager::Benchmark
+{
+	FString FResult::GetKey() const
+	{
+		return FString::Printf(TEXT("%s/%d/%d"), *Name, NumTags, NumListeners);
+	}
+
+	void RunManagerBenchmarks(Commandlets::FScopedTestWorld& TestWorld, TConstArrayView<FGameplayTag> Tags,
+		int32 NumListeners, int32 Iterations, TArray<FResult>& OutResults)
+	{
+		UGameplayTagManager* TagManager = TestWorld.SpawnManager();
+		if (!IsValid(TagManager))
+		{
+			return;
+		}
+
+		const int32 NumTags = Tags.Num();
+		for (const FGameplayTag& Tag : Tags)
+		{
+			TagManager->AddTag(Tag);
+		}
+
+		for (int32 Index = 0; Index < NumListeners; ++Index)
+		{
+			TagManager->BindGameplayTagListener(UGameplayTagManager::FOnTagChangedSimpleSignature::CreateLambda(
+				[](UGameplayTagManager*, FGameplayTag, bool)
+				{
+				}), Tags[Index % NumTags]);
+		}
+
+		auto AddResult = [&](const TCHAR* Name, double NanosecondsPerOp)
+		{
+			FResult& Result = OutResults.AddDefaulted_GetRef();
+			Result.Name = Name;
+			Result.NumTags = NumTags;
+			Result.NumListeners = NumListeners;
+			Result.Iterations = Iterations;
+			Result.NanosecondsPerOp = NanosecondsPerOp;
+		};
+
+		AddResult(TEXT("AddStack"), MeasureNanosecondsPerOp(Iterations, [&](int32 Index)
+		{
+			TagManager->AddTag(Tags[Index % NumTags]);
+		}));
+
+		AddResult(TEXT("RemoveStack"), MeasureNanosecondsPerOp(Iterations, [&](int32 Index)
+		{
+			TagManager->RemoveTag(Tags[Index % NumTags]);
+		}));
+
+		AddResult(TEXT("OverrideStack"), MeasureNanosecondsPerOp(Iterations, [&](int32 Index)
+		{
+			TagManager->OverrideTag(Tags[Index % NumTags], 2 + (Index / NumTags) % 2);
+		}));
+
+		int32 Matches = 0;
+		AddResult(TEXT("HasTag"), MeasureNanosecondsPerOp(Iterations, [&](int32 Index)
+		{
+			Matches += TagManager->HasTag(Tags[Index % NumTags]);
+		}));
+
+		const FGameplayTagContainer AllTags = FGameplayTagContainer::CreateFromArray(TArray<FGameplayTag>(Tags));
+		AddResult(TEXT("HasAllTags"), MeasureNanosecondsPerOp(Iterations, [&](int32 Index)
+		{
+			Matches += TagManager->HasAllTags(AllTags);
+		}));
+
+		// Every override below makes the tag appear or disappear, so each one notifies about a single tag
+		AddResult(TEXT("NotifyTagsChanged"), MeasureNanosecondsPerOp(Iterations, [&](int32 Index)
+		{
+			const FGameplayTag& Tag = Tags[Index % NumTags];
+			TagManager->OverrideTag(Tag, TagManager->HasTag(Tag) ? 0 : 1);
+		}));
+
+		UE_LOG(LogGameplayTagManager, Verbose, TEXT("Benchmark matches: %d"), Matches);
+
+		TagManager->GetOwner()->Destroy();
+	}
+
+	void RunSerializationBenchmarks(TConstArrayView<FGameplayTag> Tags, int32 Iterations, TArray<FResult>& OutResults)
+	{
+		FGTM_GameplayTagStackContainer ServerContainer(nullptr, EGTM_StackContainerId::Replicated);
+		FGTM_GameplayTagStackContainer ClientContainer(nullptr, EGTM_StackContainerId::Replicated);
+		ServerContainer.OnInternalsChangedDelegate.BindLambda([] { });
+		ClientContainer.OnInternalsChangedDelegate.BindLambda([] { });
+
+		const int32 NumTags = Tags.Num();
+		for (const FGameplayTag& Tag : Tags)
+		{
+			ServerContainer.AddStack(Tag, 1);
+		}
+
+		Commandlets::FNetSerializationHarness Harness;
+		TSharedPtr<INetDeltaBaseState> BaseState;
+		TArray<uint8> Data;
+		int64 NumBits = 0;
+
+		// Initial replication isn't part of the measurement
+		if (Harness.Write(ServerContainer, nullptr, BaseState, Data, NumBits))
+		{
+			Harness.Read(ClientContainer, Data, NumBits);
+		}
+
+		double WriteSeconds = 0.0;
+		double ReadSeconds = 0.0;
+		int64 TotalBits = 0;
+		for (int32 Index = 0; Index < Iterations; ++Index)
+		{
+			ServerContainer.AddStack(Tags[Index % NumTags], 1);
+
+			TSharedPtr<INetDeltaBaseState> NewState;
+			const double WriteStartTime = FPlatformTime::Seconds();
+			const bool bWritten = Harness.Write(ServerContainer, BaseState, NewState, Data, NumBits);
+			WriteSeconds += FPlatformTime::Seconds() - WriteStartTime;
+
+			if (bWritten)
+			{
+				BaseState = NewState;
+				TotalBits += NumBits;
+
+				const double ReadStartTime = FPlatformTime::Seconds();
+				Harness.Read(ClientContainer, Data, NumBits);
+				ReadSeconds += FPlatformTime::Seconds() - ReadStartTime;
+			}
+		}
+
+		FResult& WriteResult = OutResults.AddDefaulted_GetRef();
+		WriteResult.Name = TEXT("NetDeltaSerialize_Write");
+		WriteResult.NumTags = NumTags;
+		WriteResult.Iterations = Iterations;
+		WriteResult.NanosecondsPerOp = WriteSeconds * 1e9 / Iterations;
+		WriteResult.BytesPerOp = TotalBits / 8.0 / Iterations;
+
+		FResult& ReadResult = OutResults.AddDefaulted_GetRef();
+		ReadResult.Name = TEXT("NetDeltaSerialize_Read");
+		ReadResult.NumTags = NumTags;
+		ReadResult.Iterations = Iterations;
+		ReadResult.NanosecondsPerOp = ReadSeconds * 1e9 / Iterations;
+	}
+
+	TArray<FResult> RunAll(TConstArrayView<int32> TagCounts, TConstArrayView<int32> ListenerCounts, int32 Iterations)
+	{
+		int32 MaxTagCount = 0;
+		for (const int32 TagCount : TagCounts)
+		{
+			MaxTagCount = FMath::Max(MaxTagCount, TagCount);
+		}
+
+		TArray<FResult> Results;
+
+		const TArray<FGameplayTag> AvailableTags = Commandlets::GetRegisteredTags(MaxTagCount);
+		if (AvailableTags.IsEmpty())
+		{
+			return Results;
+		}
+
+		Commandlets::FScopedTestWorld TestWorld;
+		for (const int32 TagCount : TagCounts)
+		{
+			const int32 NumTags = FMath::Clamp(TagCount, 1, AvailableTags.Num());
+			const TConstArrayView<FGameplayTag> Tags(AvailableTags.GetData(), NumTags);
+
+			for (const int32 NumListeners : ListenerCounts)
+			{
+				RunManagerBenchmarks(TestWorld, Tags, NumListeners, Iterations, Results);
+			}
+
+			RunSerializationBenchmarks(Tags, Iterations, Results);
+		}
+
+		return Results;
+	}
+
+	bool SaveJson(const TArray<FResult>& Results, const FString& Path, const FString& Configuration,
+		float Threshold)
+	{
+		TArray<TSharedPtr<FJsonValue>> JsonResults;
+		for (const FResult& Result : Results)
+		{
+			auto JsonResult = MakeShared<FJsonObject>();
+			JsonResult->SetStringField(TEXT("Name"), Result.Name);
+			JsonResult->SetNumberField(TEXT("Tags"), Result.NumTags);
+			JsonResult->SetNumberField(TEXT("Listeners"), Result.NumListeners);
+			JsonResult->SetNumberField(TEXT("Iterations"), Result.Iterations);
+			JsonResult->SetNumberField(TEXT("NsPerOp"), Result.NanosecondsPerOp);
+			JsonResult->SetNumberField(TEXT("BytesPerOp"), Result.BytesPerOp);
+			JsonResults.Add(MakeShared<FJsonValueObject>(JsonResult));
+		}
+
+		auto JsonObject = MakeShared<FJsonObject>();
+		JsonObject->SetStringField(TEXT("Configuration"), Configuration);
+		JsonObject->SetNumberField(TEXT("Threshold"), Threshold);
+		JsonObject->SetArrayField(TEXT("Results"), JsonResults);
+
+		FString JsonString;
+		const auto Writer = TJsonWriterFactory<>::Create(&JsonString);
+		FJsonSerializer::Serialize(JsonObject, Writer);
+		return FFileHelper::SaveStringToFile(JsonString, *Path);
+	}
+
+	bool SaveCsv(const TArray<FResult>& Results, const FString& Path)
+	{
+		FString CsvString = TEXT("Name,Tags,Listeners,Iterations,NsPerOp,BytesPerOp\n");
+		for (const FResult& Result : Results)
+		{
+			CsvString += FString::Printf(TEXT("%s,%d,%d,%d,%.2f,%.2f\n"), *Result.Name, Result.NumTags,
+				Result.NumListeners, Result.Iterations, Result.NanosecondsPerOp, Result.BytesPerOp);
+		}
+
+		return FFileHelper::SaveStringToFile(CsvString, *Path);
+	}
+
+	bool LoadBaseline(const FString& Path, FBaseline& OutBaseline)
+	{
+		FString JsonString;
+		if (!FFileHelper::LoadFileToString(JsonString, *Path))
+		{
+			return false;
+		}
+
+		TSharedPtr<FJsonObject> JsonObject;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), JsonObject) || !JsonObject)
+		{
+			return false;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* JsonResults;
+		if (!JsonObject->TryGetArrayField(TEXT("Results"), JsonResults))
+		{
+			return false;
+		}
+
+		JsonObject->TryGetStringField(TEXT("Configuration"), OutBaseline.Configuration);
+		JsonObject->TryGetNumberField(TEXT("Threshold"), OutBaseline.Threshold);
+
+		for (const TSharedPtr<FJsonValue>& JsonValue : *JsonResults)
+		{
+			const TSharedPtr<FJsonObject>& JsonResult = JsonValue->AsObject();
+			if (!JsonResult)
+			{
+				continue;
+			}
+
+			FResult Result;
+			Result.Name = JsonResult->GetStringField(TEXT("Name"));
+			Result.NumTags = JsonResult->GetIntegerField(TEXT("Tags"));
+			Result.NumListeners = JsonResult->GetIntegerField(TEXT("Listeners"));
+			Result.Iterations = JsonResult->GetIntegerField(TEXT("Iterations"));
+			Result.NanosecondsPerOp = JsonResult->GetNumberField(TEXT("NsPerOp"));
+			Result.BytesPerOp = JsonResult->GetNumberField(TEXT("BytesPerOp"));
+			OutBaseline.Results.Add(Result.GetKey(), Result);
+		}
+
+		return true;
+	}
+
+	FComparison CompareWithBaseline(const TArray<FResult>& Results, const FBaseline& Baseline)
+	{
+		FComparison Comparison;
+		const double Limit = 1.0 + Baseline.Threshold;
+		for (const FResult& Result : Results)
+		{
+			const FResult* BaselineResult = Baseline.Results.Find(Result.GetKey());
+			if (!BaselineResult)
+			{
+				continue;
+			}
+
+			if (Result.BytesPerOp > BaselineResult->BytesPerOp * Limit)
+			{
+				Comparison.Regressions.Add(FString::Printf(TEXT("Regression in %s: %.2f B/op (baseline %.2f B/op)"),
+					*Result.GetKey(), Result.BytesPerOp, BaselineResult->BytesPerOp));
+			}
+
+			// Faster and slower both get reported, an unexpected speedup is as worth a look as a slowdown
+			const double Ratio = BaselineResult->NanosecondsPerOp > 0.0
+				? Result.NanosecondsPerOp / BaselineResult->NanosecondsPerOp
+				: 1.0;
+			if (Ratio > Limit || Ratio < 1.0 / Limit)
+			{
+				Comparison.TimingChanges.Add(FString::Printf(TEXT("%s: %.2f ns/op (baseline %.2f ns/op, %+.0f%%)"),
+					*Result.GetKey(), Result.NanosecondsPerOp, BaselineResult->NanosecondsPerOp,
+					(Ratio - 1.0) * 100.0));
+			}
+		}
+
+		return Comparison;
+	}
+
+	FString GetConfiguration()
+	{
+		return FString::Printf(TEXT("%s, %d cores, %s"), *FPlatformMisc::GetCPUBrand().TrimStartAndEnd(),
+			FPlatformMisc::NumberOfCores(), LexToString(FApp::GetBuildConfiguration()));
+	}
+
+	FString GetDefaultBaselinePath()
+	{
+		const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("GameplayTagManager"));
+		return Plugin
+			? Plugin->GetBaseDir() / TEXT("Resources/Benchmark/BenchmarkBaseline.json")
+			: FString();
+	}
+
+	const TArray<int32>& GetDefaultTagCounts()
+	{
+		static const TArray<int32> TagCounts = { 8, 64, 256 };
+		return TagCounts;
+	}
+
+	const TArray<int32>& GetDefaultListenerCounts()
+	{
+		static const TArray<int32> ListenerCounts = { 0, 16, 128 };
+		return ListenerCounts;
+	}
+}
@@ -0,0 +1,77 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+
+namespace GameplayTagManager::Commandlets
+{
+	class FScopedTestWorld;
+}
+
+namespace GameplayTagManager::Benchmark
+{
+	struct FResult
+	{
+	public:
+		FString GetKey() const;
+
+	public:
+		FString Name;
+		int32 NumTags = 0;
+		int32 NumListeners = 0;
+		int32 Iterations = 0;
+		double NanosecondsPerOp = 0.0;
+		double BytesPerOp = 0.0;
+	};
+
+	struct FBaseline
+	{
+	public:
+		TMap<FString, FResult> Results;
+
+		/** Machine and build configuration the baseline was recorded on, see GetConfiguration. */
+		FString Configuration;
+
+		/** How much worse than the baseline a result can be before it counts as a regression, 0.15 being 15%. */
+		float Threshold = 0.15f;
+	};
+
+	struct FComparison
+	{
+	public:
+		/** Results whose bytes per operation grew past the threshold. These are deterministic and fail the run. */
+		TArray<FString> Regressions;
+
+		/** Results whose time per operation moved past the threshold. Timings are noisy, so these are only reported. */
+		TArray<FString> TimingChanges;
+	};
+
+	/** Measures the manager operations on the given tags with NumListeners listeners bound. */
+	void RunManagerBenchmarks(Commandlets::FScopedTestWorld& TestWorld, TConstArrayView<FGameplayTag> Tags,
+		int32 NumListeners, int32 Iterations, TArray<FResult>& OutResults);
+
+	/** Measures delta serialization of a replicated container holding the given tags. */
+	void RunSerializationBenchmarks(TConstArrayView<FGameplayTag> Tags, int32 Iterations, TArray<FResult>& OutResults);
+
+	/** Runs every benchmark for each combination of tag and listener counts. */
+	TArray<FResult> RunAll(TConstArrayView<int32> TagCounts, TConstArrayView<int32> ListenerCounts, int32 Iterations);
+
+	bool SaveJson(const TArray<FResult>& Results, const FString& Path, const FString& Configuration,
+		float Threshold);
+	bool SaveCsv(const TArray<FResult>& Results, const FString& Path);
+	bool LoadBaseline(const FString& Path, FBaseline& OutBaseline);
+
+	/** Describes every result that moved past the baseline threshold, see FComparison. */
+	FComparison CompareWithBaseline(const TArray<FResult>& Results, const FBaseline& Baseline);
+
+	/** Returns the CPU and build configuration of this process, used to tell whether timings are comparable. */
+	FString GetConfiguration();
+
+	/** Returns the path to the baseline checked into the plugin. */
+	FString GetDefaultBaselinePath();
+
+	/** Tag and listener counts the checked in baseline covers. */
+	const TArray<int32>& GetDefaultTagCounts();
+	const TArray<int32>& GetDefaultListenerCounts();
+}
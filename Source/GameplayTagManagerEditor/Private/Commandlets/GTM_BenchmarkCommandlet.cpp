@@ -0,0 +1,101 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Commandlets/GTM_BenchmarkCommandlet.h"
+
+#include "Commandlets/GTM_Benchmark.h"
+#include "Commandlets/GTM_CommandletUtils.h"
+#include "Gameplay/Misc/GameplayTagManager.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	using namespace GameplayTagManager::Benchmark;
+	using namespace GameplayTagManager::Commandlets;
+}
+
+UGTM_BenchmarkCommandlet::UGTM_BenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+
+	HelpDescription = TEXT("Benchmarks the gameplay tag manager hot paths and compares them against a baseline. "
+		"Bytes per operation regressions fail the run, timing changes are only reported.");
+	HelpUsage = TEXT("-run=GTM_Benchmark [-Tags=8,64,256] [-Listeners=0,16,128] [-Iterations=10000] [-Output=<Dir>] "
+		"[-Baseline=<File.json>] [-Threshold=<Fraction>] [-WriteBaseline]");
+}
+
+int32 UGTM_BenchmarkCommandlet::Main(const FString& Params)
+{
+	const TArray<int32> TagCounts = ParseIntList(*Params, TEXT("Tags="), GetDefaultTagCounts());
+	const TArray<int32> ListenerCounts = ParseIntList(*Params, TEXT("Listeners="), GetDefaultListenerCounts());
+
+	int32 Iterations = 10000;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	Iterations = FMath::Max(Iterations, 1);
+
+	FString OutputDir = FPaths::ProjectSavedDir() / TEXT("GameplayTagManager");
+	FParse::Value(*Params, TEXT("Output="), OutputDir);
+
+	FString BaselinePath = GetDefaultBaselinePath();
+	FParse::Value(*Params, TEXT("Baseline="), BaselinePath);
+
+	FBaseline Baseline;
+	const bool bHasBaseline = LoadBaseline(BaselinePath, Baseline);
+
+	// The threshold stored along with the baseline applies unless overridden
+	FParse::Value(*Params, TEXT("Threshold="), Baseline.Threshold);
+
+	const TArray<FResult> Results = RunAll(TagCounts, ListenerCounts, Iterations);
+	if (Results.IsEmpty())
+	{
+		UE_LOG(LogGameplayTagManager, Error, TEXT("The project has no gameplay tags to benchmark with."));
+		return 1;
+	}
+
+	for (const FResult& Result : Results)
+	{
+		UE_LOG(LogGameplayTagManager, Display, TEXT("%-24s Tags %4d Listeners %4d: %10.2f ns/op %8.2f B/op"),
+			*Result.Name, Result.NumTags, Result.NumListeners, Result.NanosecondsPerOp, Result.BytesPerOp);
+	}
+
+	const FString Configuration = GetConfiguration();
+	SaveCsv(Results, OutputDir / TEXT("Benchmark.csv"));
+	SaveJson(Results, OutputDir / TEXT("Benchmark.json"), Configuration, Baseline.Threshold);
+
+	if (FParse::Param(*Params, TEXT("WriteBaseline")))
+	{
+		SaveJson(Results, BaselinePath, Configuration, Baseline.Threshold);
+		UE_LOG(LogGameplayTagManager, Display, TEXT("Baseline for %s written to %s"), *Configuration, *BaselinePath);
+		return 0;
+	}
+
+	if (!bHasBaseline || Baseline.Results.IsEmpty())
+	{
+		UE_LOG(LogGameplayTagManager, Warning, TEXT("No baseline results at %s; run with -WriteBaseline on the "
+			"reference configuration to record them."), *BaselinePath);
+		return 0;
+	}
+
+	// Timings only mean something against a baseline recorded on the same machine and build
+	const FComparison Comparison = CompareWithBaseline(Results, Baseline);
+	if (!Comparison.TimingChanges.IsEmpty() && Baseline.Configuration != Configuration)
+	{
+		UE_LOG(LogGameplayTagManager, Display, TEXT("Baseline was recorded on %s, this run is %s; timing changes "
+			"below are not comparable."), *Baseline.Configuration, *Configuration);
+	}
+
+	for (const FString& TimingChange : Comparison.TimingChanges)
+	{
+		UE_LOG(LogGameplayTagManager, Warning, TEXT("%s"), *TimingChange);
+	}
+
+	for (const FString& Regression : Comparison.Regressions)
+	{
+		UE_LOG(LogGameplayTagManager, Error, TEXT("%s"), *Regression);
+	}
+
+	return Comparison.Regressions.IsEmpty() ? 0 : 1;
+}
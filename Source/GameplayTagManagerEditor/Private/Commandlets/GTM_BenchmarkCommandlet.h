@@ -0,0 +1,31 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "GTM_BenchmarkCommandlet.generated.h"
+
+/**
+ * Measures the hot paths of the gameplay tag manager and compares them against a stored baseline.
+ *
+ * Usage: UnrealEditor-Cmd.exe <Project> -run=GTM_Benchmark [-Tags=8,64,256] [-Listeners=0,16,128]
+ *		[-Iterations=10000] [-Output=<Dir>] [-Baseline=<File.json>] [-Threshold=<Fraction>] [-WriteBaseline]
+ *
+ * Results are written as CSV and JSON to the output directory. The baseline defaults to the one checked into the
+ * plugin under Resources/Benchmark, and its stored threshold applies unless -Threshold is passed. Returns a non-zero
+ * exit code if any result is slower or bigger than the baseline by more than the threshold.
+ */
+UCLASS()
+class UGTM_BenchmarkCommandlet
+	: public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGTM_BenchmarkCommandlet();
+
+	//~UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~End of UCommandlet Interface
+};
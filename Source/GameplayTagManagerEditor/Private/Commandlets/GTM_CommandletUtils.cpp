@@ -0,0 +1,161 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Commandlets/GTM_CommandletUtils.h"
+
+#include "Engine/DemoNetDriver.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Gameplay/Misc/GameplayTagManager.h"
+#include "GameplayTagsManager.h"
+#include "Net/RepLayout.h"
+#include "UObject/CoreNet.h"
+#include "UObject/Package.h"
+
+namespace GameplayTagManager::Commandlets
+{
+	FScopedTestWorld::FScopedTestWorld()
+	{
+		UWorld::InitializationValues InitValues;
+		InitValues
+			.InitializeScenes(false)
+			.AllowAudioPlayback(false)
+			.RequiresHitProxies(false)
+			.CreatePhysicsScene(false)
+			.CreateNavigation(false)
+			.CreateAISystem(false)
+			.ShouldSimulatePhysics(false)
+			.SetTransactional(false);
+
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("GTM_TestWorld"), nullptr, true,
+			ERHIFeatureLevel::Num, &InitValues);
+
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+	}
+
+	FScopedTestWorld::~FScopedTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	UWorld* FScopedTestWorld::GetWorld() const
+	{
+		return World;
+	}
+
+	UGameplayTagManager* FScopedTestWorld::SpawnManager(TSubclassOf<AActor> ActorClass)
+	{
+		UClass* Class = ActorClass ? ActorClass.Get() : AActor::StaticClass();
+		AActor* Actor = World->SpawnActor<AActor>(Class, FTransform::Identity);
+		if (!IsValid(Actor))
+		{
+			return nullptr;
+		}
+
+		auto* TagManager = Actor->FindComponentByClass<UGameplayTagManager>();
+		if (!IsValid(TagManager))
+		{
+			TagManager = NewObject<UGameplayTagManager>(Actor);
+			TagManager->RegisterComponent();
+		}
+
+		return TagManager;
+	}
+
+	FNetSerializationHarness::FNetSerializationHarness()
+		: NetDriver(NewObject<UDemoNetDriver>(GetTransientPackage()))
+		, NetSerializeCB(MakeUnique<FNetSerializeCB>(NetDriver.Get()))
+	{
+	}
+
+	FNetSerializationHarness::~FNetSerializationHarness()
+	{
+	}
+
+	bool FNetSerializationHarness::Write(FGTM_GameplayTagStackContainer& Source,
+		const TSharedPtr<INetDeltaBaseState>& BaseState, TSharedPtr<INetDeltaBaseState>& OutNewState,
+		TArray<uint8>& OutData, int64& OutNumBits)
+	{
+		FNetBitWriter Writer(nullptr, 8 * 1024);
+
+		FNetDeltaSerializeInfo Parms;
+		Parms.Writer = &Writer;
+		Parms.OldState = BaseState.Get();
+		Parms.NewState = &OutNewState;
+		Parms.NetSerializeCB = NetSerializeCB.Get();
+		Parms.Object = NetDriver.Get();
+
+		if (!Source.NetDeltaSerialize(Parms))
+		{
+			OutNumBits = 0;
+			return false;
+		}
+
+		OutNumBits = Writer.GetNumBits();
+		OutData = *Writer.GetBuffer();
+		return true;
+	}
+
+	void FNetSerializationHarness::Read(FGTM_GameplayTagStackContainer& Target, TArray<uint8>& Data, int64 NumBits)
+	{
+		FNetBitReader Reader(nullptr, Data.GetData(), NumBits);
+
+		FNetDeltaSerializeInfo Parms;
+		Parms.Reader = &Reader;
+		Parms.NetSerializeCB = NetSerializeCB.Get();
+		Parms.Object = NetDriver.Get();
+
+		Target.NetDeltaSerialize(Parms);
+	}
+
+	TArray<FGameplayTag> GetRegisteredTags(int32 Num)
+	{
+		FGameplayTagContainer AllTags;
+		UGameplayTagsManager::Get().RequestAllGameplayTags(AllTags, false);
+
+		TArray<FGameplayTag> Tags = AllTags.GetGameplayTagArray();
+		if (Tags.Num() > Num)
+		{
+			Tags.SetNum(Num);
+		}
+
+		return Tags;
+	}
+
+	TArray<int32> ParseIntList(const TCHAR* Params, const TCHAR* Key, const TArray<int32>& Default)
+	{
+		FString Value;
+		if (!FParse::Value(Params, Key, Value))
+		{
+			return Default;
+		}
+
+		TArray<FString> Entries;
+		Value.ParseIntoArray(Entries, TEXT(","));
+
+		TArray<int32> Result;
+		for (const FString& Entry : Entries)
+		{
+			Result.Add(FCString::Atoi(*Entry));
+		}
+
+		return Result.IsEmpty() ? Default : Result;
+	}
+
+	double GetPercentile(const TArray<double>& SortedSamples, double Percentile)
+	{
+		if (SortedSamples.IsEmpty())
+		{
+			return 0.0;
+		}
+
+		const int32 Index = FMath::Clamp(FMath::FloorToInt32(Percentile / 100.0 * SortedSamples.Num()),
+			0, SortedSamples.Num() - 1);
+		return SortedSamples[Index];
+	}
+}
@@ -0,0 +1,66 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "GameplayTagContainer.h"
+#include "Templates/SubclassOf.h"
+#include "UObject/StrongObjectPtr.h"
+
+class AActor;
+class FNetSerializeCB;
+class INetDeltaBaseState;
+class UDemoNetDriver;
+class UGameplayTagManager;
+class UWorld;
+struct FGTM_GameplayTagStackContainer;
+
+namespace GameplayTagManager::Commandlets
+{
+	/**
+	 * Game world without rendering, physics or networking that lives for the duration of the scope.
+	 */
+	class FScopedTestWorld
+	{
+	public:
+		FScopedTestWorld();
+		~FScopedTestWorld();
+
+		UWorld* GetWorld() const;
+
+		/** Spawns an actor and returns its tag manager, adding one if the actor doesn't have it by default. */
+		UGameplayTagManager* SpawnManager(TSubclassOf<AActor> ActorClass = nullptr);
+
+	private:
+		UWorld* World = nullptr;
+	};
+
+	/**
+	 * Serializes stack containers the same way the replication system does, without any connection involved.
+	 */
+	class FNetSerializationHarness
+	{
+	public:
+		FNetSerializationHarness();
+		~FNetSerializationHarness();
+
+		/** Writes the changes made since BaseState. Returns false if there was nothing to write. */
+		bool Write(FGTM_GameplayTagStackContainer& Source, const TSharedPtr<INetDeltaBaseState>& BaseState,
+			TSharedPtr<INetDeltaBaseState>& OutNewState, TArray<uint8>& OutData, int64& OutNumBits);
+
+		/** Applies data produced by Write. */
+		void Read(FGTM_GameplayTagStackContainer& Target, TArray<uint8>& Data, int64 NumBits);
+
+	private:
+		TStrongObjectPtr<UDemoNetDriver> NetDriver;
+		TUniquePtr<FNetSerializeCB> NetSerializeCB;
+	};
+
+	/** Returns up to Num tags registered in the project. */
+	TArray<FGameplayTag> GetRegisteredTags(int32 Num);
+
+	/** Parses a comma separated list of integers passed as Key=1,2,3. */
+	TArray<int32> ParseIntList(const TCHAR* Params, const TCHAR* Key, const TArray<int32>& Default);
+
+	/** Returns the value at the given percentile (0-100) of the sorted samples. */
+	double GetPercentile(const TArray<double>& SortedSamples, double Percentile);
+}
@@ -0,0 +1,61 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Commandlets/GTM_LoadSimulationActor.h"
+
+#include "Gameplay/Misc/GameplayTagManager.h"
+
+void FGTM_LoadSimulationPropertyMap::AddMapping(FGameplayTag Tag, FName PropertyName)
+{
+	FGTM_GameplayTagBlueprintPropertyMapping& Mapping = PropertyMappings.AddDefaulted_GetRef();
+	Mapping.TagToMap = Tag;
+	Mapping.PropertyName = PropertyName;
+}
+
+void FGTM_LoadSimulationPropertyMap::Reset()
+{
+	Unregister();
+	PropertyMappings.Reset();
+}
+
+AGTM_LoadSimulationActor::AGTM_LoadSimulationActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	GameplayTagManager = CreateDefaultSubobject<UGameplayTagManager>(TEXT("GameplayTagManager"));
+}
+
+void AGTM_LoadSimulationActor::InitializePropertyMap(TConstArrayView<FGameplayTag> Tags)
+{
+	if (Tags.IsEmpty())
+	{
+		return;
+	}
+
+	static const FName PropertyNames[NumMappedProperties] =
+	{
+		GET_MEMBER_NAME_CHECKED(ThisClass, bMappedProperty0),
+		GET_MEMBER_NAME_CHECKED(ThisClass, bMappedProperty1),
+		GET_MEMBER_NAME_CHECKED(ThisClass, bMappedProperty2),
+		GET_MEMBER_NAME_CHECKED(ThisClass, bMappedProperty3),
+	};
+
+	for (int32 Index = 0; Index < NumMappedProperties; ++Index)
+	{
+		PropertyMap.AddMapping(Tags[Index % Tags.Num()], PropertyNames[Index]);
+	}
+
+	PropertyMap.Initialize(this, GameplayTagManager);
+}
+
+UGameplayTagManager* AGTM_LoadSimulationActor::GetGameplayTagManager() const
+{
+	return GameplayTagManager;
+}
+
+void AGTM_LoadSimulationActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Unbind from the manager while it's still alive
+	PropertyMap.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
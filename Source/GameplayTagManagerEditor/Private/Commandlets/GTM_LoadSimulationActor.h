@@ -0,0 +1,68 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "GameFramework/Actor.h"
+#include "Gameplay/Misc/GTM_GameplayTagBlueprintPropertyMap.h"
+
+#include "GTM_LoadSimulationActor.generated.h"
+
+class UGameplayTagManager;
+
+/**
+ * Property map that can be filled from code, used to attach bindings without a blueprint.
+ */
+struct FGTM_LoadSimulationPropertyMap
+	: public FGTM_GameplayTagBlueprintPropertyMap
+{
+public:
+	void AddMapping(FGameplayTag Tag, FName PropertyName);
+
+	/** Unbinds from the manager and removes all mappings. */
+	void Reset();
+};
+
+/**
+ * Actor spawned by the load simulation commandlet. Mirrors a typical tagged NPC: a tag manager and a handful of
+ * boolean properties bound to tags.
+ */
+UCLASS(NotBlueprintable, Transient)
+class AGTM_LoadSimulationActor
+	: public AActor
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 NumMappedProperties = 4;
+
+public:
+	AGTM_LoadSimulationActor();
+
+	/** Binds the mapped properties to the given tags, wrapping around if there are fewer tags than properties. */
+	void InitializePropertyMap(TConstArrayView<FGameplayTag> Tags);
+
+	UGameplayTagManager* GetGameplayTagManager() const;
+
+	//~AActor Interface
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	//~End of AActor Interface
+
+public:
+	UPROPERTY(Transient)
+	bool bMappedProperty0 = false;
+
+	UPROPERTY(Transient)
+	bool bMappedProperty1 = false;
+
+	UPROPERTY(Transient)
+	bool bMappedProperty2 = false;
+
+	UPROPERTY(Transient)
+	bool bMappedProperty3 = false;
+
+private:
+	UPROPERTY(VisibleAnywhere, Category="Gameplay Tags")
+	TObjectPtr<UGameplayTagManager> GameplayTagManager;
+
+	FGTM_LoadSimulationPropertyMap PropertyMap;
+};
@@ -0,0 +1,278 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Commandlets/GTM_LoadSimulationCommandlet.h"
+
+#include "Commandlets/GTM_CommandletUtils.h"
+#include "Commandlets/GTM_LoadSimulationActor.h"
+#include "Engine/World.h"
+#include "Gameplay/Misc/GameplayTagManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	using namespace GameplayTagManager::Commandlets;
+
+	bool LoadScript(const FString& Path, TArray<FGTM_TagOperation>& OutOperations)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *Path))
+		{
+			return false;
+		}
+
+		for (const FString& Line : Lines)
+		{
+			TArray<FString> Tokens;
+			Line.ParseIntoArrayWS(Tokens);
+			if (Tokens.Num() < 2 || Tokens[0].StartsWith(TEXT("#")))
+			{
+				continue;
+			}
+
+			const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(*Tokens[1], false);
+			if (!Tag.IsValid())
+			{
+				UE_LOG(LogGameplayTagManager, Warning, TEXT("Skipping script line with unknown tag: %s"), *Line);
+				continue;
+			}
+
+			EGTM_TagMutationType Mutation;
+			if (Tokens[0] == TEXT("Add"))
+			{
+				Mutation = EGTM_TagMutationType::Add;
+			}
+			else if (Tokens[0] == TEXT("Remove"))
+			{
+				Mutation = EGTM_TagMutationType::Remove;
+			}
+			else if (Tokens[0] == TEXT("Override"))
+			{
+				Mutation = EGTM_TagMutationType::Override;
+			}
+			else
+			{
+				UE_LOG(LogGameplayTagManager, Warning, TEXT("Skipping script line with unknown operation: %s"), *Line);
+				continue;
+			}
+
+			const int32 Count = Tokens.IsValidIndex(2) ? FCString::Atoi(*Tokens[2]) : 1;
+			OutOperations.Emplace(Tag, Mutation, Count);
+		}
+
+		return !OutOperations.IsEmpty();
+	}
+
+	FGTM_TagOperation MakeRandomOperation(FRandomStream& RandomStream, TConstArrayView<FGameplayTag> Tags)
+	{
+		const FGameplayTag& Tag = Tags[RandomStream.RandHelper(Tags.Num())];
+		switch (RandomStream.RandHelper(3))
+		{
+			case 0:
+				return FGTM_TagOperation(Tag, EGTM_TagMutationType::Add);
+			case 1:
+				return FGTM_TagOperation(Tag, EGTM_TagMutationType::Remove);
+			default:
+				return FGTM_TagOperation(Tag, EGTM_TagMutationType::Override, RandomStream.RandRange(0, 3));
+		}
+	}
+
+	double BytesToKilobytes(SIZE_T Bytes)
+	{
+		return Bytes / 1024.0;
+	}
+
+	double GetDeltaInKilobytes(uint64 Before, uint64 After)
+	{
+		return (static_cast<double>(After) - static_cast<double>(Before)) / 1024.0;
+	}
+
+	/** Sums the memory the managers account for, leaving out whatever else the process allocates meanwhile. */
+	FGTM_TagManagerMemoryUsage SumMemoryUsage(TConstArrayView<UGameplayTagManager*> TagManagers)
+	{
+		FGTM_TagManagerMemoryUsage TotalUsage;
+		for (const UGameplayTagManager* TagManager : TagManagers)
+		{
+			TotalUsage += TagManager->GetMemoryUsage();
+		}
+
+		return TotalUsage;
+	}
+}
+
+UGTM_LoadSimulationCommandlet::UGTM_LoadSimulationCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+
+	HelpDescription = TEXT("Simulates tag churn on a large population of tagged actors and reports frame times and "
+		"memory usage.");
+	HelpUsage = TEXT("-run=GTM_LoadSimulation [-Actors=1000] [-Frames=600] [-FPS=30] [-Tags=64] [-OpsPerActor=2] "
+		"[-Listeners=4] [-Seed=0] [-Script=<File.txt>] [-Output=<Dir>]");
+}
+
+int32 UGTM_LoadSimulationCommandlet::Main(const FString& Params)
+{
+	int32 NumActors = 1000;
+	int32 NumFrames = 600;
+	int32 FramesPerSecond = 30;
+	int32 NumTags = 64;
+	int32 OpsPerActor = 2;
+	int32 NumListeners = 4;
+	int32 Seed = 0;
+	FParse::Value(*Params, TEXT("Actors="), NumActors);
+	FParse::Value(*Params, TEXT("Frames="), NumFrames);
+	FParse::Value(*Params, TEXT("FPS="), FramesPerSecond);
+	FParse::Value(*Params, TEXT("Tags="), NumTags);
+	FParse::Value(*Params, TEXT("OpsPerActor="), OpsPerActor);
+	FParse::Value(*Params, TEXT("Listeners="), NumListeners);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	NumActors = FMath::Max(NumActors, 1);
+	NumFrames = FMath::Max(NumFrames, 1);
+	FramesPerSecond = FMath::Max(FramesPerSecond, 1);
+
+	FString OutputDir = FPaths::ProjectSavedDir() / TEXT("GameplayTagManager");
+	FParse::Value(*Params, TEXT("Output="), OutputDir);
+
+	const TArray<FGameplayTag> Tags = GetRegisteredTags(FMath::Max(NumTags, 1));
+	if (Tags.IsEmpty())
+	{
+		UE_LOG(LogGameplayTagManager, Error, TEXT("The project has no gameplay tags to simulate with."));
+		return 1;
+	}
+
+	TArray<FGTM_TagOperation> ScriptOperations;
+	FString ScriptPath;
+	if (FParse::Value(*Params, TEXT("Script="), ScriptPath) && !LoadScript(ScriptPath, ScriptOperations))
+	{
+		UE_LOG(LogGameplayTagManager, Error, TEXT("Failed to load any operation from script %s"), *ScriptPath);
+		return 1;
+	}
+
+	FScopedTestWorld TestWorld;
+	UWorld* World = TestWorld.GetWorld();
+
+	int32 NumNotifications = 0;
+	const auto Listener = UGameplayTagManager::FOnTagChangedSimpleSignature::CreateLambda(
+		[&NumNotifications](UGameplayTagManager*, FGameplayTag, bool)
+		{
+			++NumNotifications;
+		});
+
+	TArray<UGameplayTagManager*> TagManagers;
+	TagManagers.Reserve(NumActors);
+	for (int32 ActorIndex = 0; ActorIndex < NumActors; ++ActorIndex)
+	{
+		UGameplayTagManager* TagManager = TestWorld.SpawnManager(AGTM_LoadSimulationActor::StaticClass());
+		if (!IsValid(TagManager))
+		{
+			continue;
+		}
+
+		for (int32 ListenerIndex = 0; ListenerIndex < NumListeners; ++ListenerIndex)
+		{
+			TagManager->BindGameplayTagListener(Listener, Tags[(ActorIndex + ListenerIndex) % Tags.Num()]);
+		}
+
+		CastChecked<AGTM_LoadSimulationActor>(TagManager->GetOwner())->InitializePropertyMap(Tags);
+		TagManagers.Add(TagManager);
+	}
+
+	const FGTM_TagManagerMemoryUsage MemoryAfterSpawn = SumMemoryUsage(TagManagers);
+
+	FRandomStream RandomStream(Seed);
+	const float DeltaSeconds = 1.f / FramesPerSecond;
+
+	// Operations are applied one at a time through the same array, so that the loop itself doesn't allocate
+	TArray<FGTM_TagOperation> Operations;
+	Operations.SetNum(1);
+
+	TArray<double> FrameTimes;
+	FrameTimes.Reserve(NumFrames);
+
+	const FPlatformMemoryStats ProcessMemoryBeforeChurn = FPlatformMemory::GetStats();
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const double FrameStartTime = FPlatformTime::Seconds();
+
+		if (ScriptOperations.IsEmpty())
+		{
+			for (UGameplayTagManager* TagManager : TagManagers)
+			{
+				for (int32 OpIndex = 0; OpIndex < OpsPerActor; ++OpIndex)
+				{
+					Operations[0] = MakeRandomOperation(RandomStream, Tags);
+					TagManager->ApplyTagOperations(Operations);
+				}
+			}
+		}
+		else
+		{
+			Operations[0] = ScriptOperations[Frame % ScriptOperations.Num()];
+			for (UGameplayTagManager* TagManager : TagManagers)
+			{
+				TagManager->ApplyTagOperations(Operations);
+			}
+		}
+
+		World->Tick(LEVELTICK_All, DeltaSeconds);
+		++GFrameCounter;
+
+		FrameTimes.Add((FPlatformTime::Seconds() - FrameStartTime) * 1000.0);
+	}
+
+	const FPlatformMemoryStats ProcessMemoryAfterChurn = FPlatformMemory::GetStats();
+	const FGTM_TagManagerMemoryUsage MemoryAfterChurn = SumMemoryUsage(TagManagers);
+
+	FString CsvString = TEXT("Frame,Milliseconds\n");
+	for (int32 Frame = 0; Frame < FrameTimes.Num(); ++Frame)
+	{
+		CsvString += FString::Printf(TEXT("%d,%.4f\n"), Frame, FrameTimes[Frame]);
+	}
+
+	FFileHelper::SaveStringToFile(CsvString, *(OutputDir / TEXT("LoadSimulation.csv")));
+
+	TArray<double> SortedFrameTimes = FrameTimes;
+	SortedFrameTimes.Sort();
+
+	SIZE_T ContainersMemory = 0;
+	for (const SIZE_T ContainerMemory : MemoryAfterChurn.Containers)
+	{
+		ContainersMemory += ContainerMemory;
+	}
+
+	const int32 NumSpawned = FMath::Max(TagManagers.Num(), 1);
+	UE_LOG(LogGameplayTagManager, Display, TEXT("Simulated %d actors for %d frames (%s workload)"),
+		TagManagers.Num(), NumFrames, ScriptOperations.IsEmpty() ? TEXT("random") : TEXT("scripted"));
+	UE_LOG(LogGameplayTagManager, Display, TEXT("Frame time ms: p50 %.3f, p90 %.3f, p99 %.3f, max %.3f"),
+		GetPercentile(SortedFrameTimes, 50.0), GetPercentile(SortedFrameTimes, 90.0),
+		GetPercentile(SortedFrameTimes, 99.0), SortedFrameTimes.Last());
+	UE_LOG(LogGameplayTagManager, Display, TEXT("Manager memory KB: after spawn %.1f (%.3f per actor), after churn "
+		"%.1f (%.3f per actor)"),
+		BytesToKilobytes(MemoryAfterSpawn.GetTotal()), BytesToKilobytes(MemoryAfterSpawn.GetTotal()) / NumSpawned,
+		BytesToKilobytes(MemoryAfterChurn.GetTotal()), BytesToKilobytes(MemoryAfterChurn.GetTotal()) / NumSpawned);
+	UE_LOG(LogGameplayTagManager, Display, TEXT("Per actor after churn B: object %.1f, containers %.1f, cached tags "
+		"%.1f, listeners %.1f, events %.1f"),
+		static_cast<double>(MemoryAfterChurn.Object) / NumSpawned,
+		static_cast<double>(ContainersMemory) / NumSpawned,
+		static_cast<double>(MemoryAfterChurn.CachedTags) / NumSpawned,
+		static_cast<double>(MemoryAfterChurn.Listeners) / NumSpawned,
+		static_cast<double>(MemoryAfterChurn.Events) / NumSpawned);
+	// Process-wide, so the world tick and the logging contribute too. The allocator exposes no allocation count;
+	// capture the run with -trace=memory to get one
+	UE_LOG(LogGameplayTagManager, Display, TEXT("Process memory change over the churn KB: used physical %+.1f, "
+		"used virtual %+.1f, peak used physical %+.1f (allocation counts need -trace=memory)"),
+		GetDeltaInKilobytes(ProcessMemoryBeforeChurn.UsedPhysical, ProcessMemoryAfterChurn.UsedPhysical),
+		GetDeltaInKilobytes(ProcessMemoryBeforeChurn.UsedVirtual, ProcessMemoryAfterChurn.UsedVirtual),
+		GetDeltaInKilobytes(ProcessMemoryBeforeChurn.PeakUsedPhysical, ProcessMemoryAfterChurn.PeakUsedPhysical));
+	UE_LOG(LogGameplayTagManager, Display, TEXT("Listener notifications: %d (%.2f per actor per frame)"),
+		NumNotifications, static_cast<double>(NumNotifications) / NumSpawned / NumFrames);
+
+	return 0;
+}
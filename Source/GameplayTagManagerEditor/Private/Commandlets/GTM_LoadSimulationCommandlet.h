@@ -0,0 +1,32 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "GTM_LoadSimulationCommandlet.generated.h"
+
+/**
+ * Spawns a population of tagged actors in a headless world, churns their tags every frame and reports how long the
+ * frames took and how much memory the population costs. Used to estimate how many tagged actors a server can host.
+ *
+ * Usage: UnrealEditor-Cmd.exe <Project> -run=GTM_LoadSimulation [-Actors=1000] [-Frames=600] [-FPS=30]
+ *		[-Tags=64] [-OpsPerActor=2] [-Listeners=4] [-Seed=0] [-Script=<File.txt>] [-Output=<Dir>]
+ *
+ * Without a script, every actor applies OpsPerActor random add/remove/override operations per frame. A script is a
+ * text file with one "<Add|Remove|Override> <Tag> [Count]" line per frame that every actor applies; it loops until
+ * all frames are simulated.
+ */
+UCLASS()
+class UGTM_LoadSimulationCommandlet
+	: public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGTM_LoadSimulationCommandlet();
+
+	//~UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~End of UCommandlet Interface
+};
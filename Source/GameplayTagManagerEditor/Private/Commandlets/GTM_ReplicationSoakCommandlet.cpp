@@ -0,0 +1,321 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Commandlets/GTM_ReplicationSoakCommandlet.h"
+
+#include "Commandlets/GTM_CommandletUtils.h"
+#include "Gameplay/Misc/GameplayTagManager.h"
+#include "Gameplay/Misc/GTM_GameplayTagStackContainer.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	using namespace GameplayTagManager::Commandlets;
+
+	constexpr EGTM_StackContainerId ReplicatedContainerIds[] =
+	{
+		EGTM_StackContainerId::Replicated,
+		EGTM_StackContainerId::OwnerOnly,
+		EGTM_StackContainerId::Authoritative,
+	};
+
+	constexpr int32 NumChannels = UE_ARRAY_COUNT(ReplicatedContainerIds);
+
+	struct FPacket
+	{
+	public:
+		int32 Sequence = INDEX_NONE;
+		int32 BaseSequence = INDEX_NONE;
+		int32 DeliveryTick = 0;
+		bool bLost = false;
+		TArray<uint8> Data;
+		int64 NumBits = 0;
+		TSharedPtr<INetDeltaBaseState> NewState;
+	};
+
+	/** One container as seen by one client, along with the state of the simulated connection that feeds it. */
+	struct FClientChannel
+	{
+	public:
+		FGTM_GameplayTagStackContainer Container;
+
+		/** State the next packet is written against. Falls back to the acknowledged one when a packet is lost. */
+		TSharedPtr<INetDeltaBaseState> SentState;
+		int32 SentSequence = INDEX_NONE;
+
+		TSharedPtr<INetDeltaBaseState> AckedState;
+		int32 AckedSequence = INDEX_NONE;
+
+		int32 NextSequence = 0;
+		TArray<FPacket> InFlightPackets;
+
+		int32 MismatchSinceTick = INDEX_NONE;
+		TArray<double> ConvergenceTimes;
+
+		int32 NumNotifications = 0;
+		int32 NumPackets = 0;
+		int32 NumLostPackets = 0;
+		int64 NumBits = 0;
+	};
+
+	struct FServerChannel
+	{
+	public:
+		FGTM_GameplayTagStackContainer Container;
+		int32 NumChanges = 0;
+	};
+
+	void MutateRandomly(FRandomStream& RandomStream, FGTM_GameplayTagStackContainer& Container,
+		TConstArrayView<FGameplayTag> Tags)
+	{
+		const FGameplayTag& Tag = Tags[RandomStream.RandHelper(Tags.Num())];
+		switch (RandomStream.RandHelper(3))
+		{
+			case 0:
+				Container.AddStack(Tag, RandomStream.RandRange(1, 2));
+				break;
+			case 1:
+				Container.RemoveStack(Tag, 1);
+				break;
+			default:
+				Container.OverrideStack(Tag, RandomStream.RandRange(0, 3));
+				break;
+		}
+	}
+
+	bool AreEqual(const FGTM_GameplayTagStackContainer& Lhs, const FGTM_GameplayTagStackContainer& Rhs)
+	{
+		return Lhs.GetTagToCountMap().OrderIndependentCompareEqual(Rhs.GetTagToCountMap());
+	}
+
+	void SendPacket(FNetSerializationHarness& Harness, FRandomStream& RandomStream, FServerChannel& Server,
+		FClientChannel& Client, int32 Tick, int32 LatencyTicks, float Loss)
+	{
+		FPacket Packet;
+		Packet.BaseSequence = Client.SentSequence;
+		if (!Harness.Write(Server.Container, Client.SentState, Packet.NewState, Packet.Data, Packet.NumBits))
+		{
+			return;
+		}
+
+		Packet.Sequence = Client.NextSequence++;
+		Packet.DeliveryTick = Tick + LatencyTicks;
+		Packet.bLost = RandomStream.FRand() < Loss;
+
+		Client.SentState = Packet.NewState;
+		Client.SentSequence = Packet.Sequence;
+		Client.NumBits += Packet.NumBits;
+		Client.NumPackets++;
+		Client.InFlightPackets.Add(MoveTemp(Packet));
+	}
+
+	void ReceivePackets(FNetSerializationHarness& Harness, FClientChannel& Client, int32 Tick)
+	{
+		int32 NumProcessed = 0;
+		for (FPacket& Packet : Client.InFlightPackets)
+		{
+			if (Packet.DeliveryTick > Tick)
+			{
+				break;
+			}
+
+			NumProcessed++;
+
+			if (Packet.bLost)
+			{
+				// Resend everything the client hasn't acknowledged yet
+				Client.NumLostPackets++;
+				Client.SentState = Client.AckedState;
+				Client.SentSequence = Client.AckedSequence;
+				continue;
+			}
+
+			Harness.Read(Client.Container, Packet.Data, Packet.NumBits);
+
+			// Packets written on top of a lost one are applied, but the state they lead to isn't complete
+			if (Packet.BaseSequence == Client.AckedSequence)
+			{
+				Client.AckedState = Packet.NewState;
+				Client.AckedSequence = Packet.Sequence;
+			}
+		}
+
+		Client.InFlightPackets.RemoveAt(0, NumProcessed);
+	}
+
+	void UpdateConvergence(const FServerChannel& Server, FClientChannel& Client, int32 Tick, double MillisecondsPerTick)
+	{
+		if (AreEqual(Server.Container, Client.Container))
+		{
+			if (Client.MismatchSinceTick != INDEX_NONE)
+			{
+				Client.ConvergenceTimes.Add((Tick - Client.MismatchSinceTick) * MillisecondsPerTick);
+				Client.MismatchSinceTick = INDEX_NONE;
+			}
+		}
+		else if (Client.MismatchSinceTick == INDEX_NONE)
+		{
+			Client.MismatchSinceTick = Tick;
+		}
+	}
+}
+
+UGTM_ReplicationSoakCommandlet::UGTM_ReplicationSoakCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+
+	HelpDescription = TEXT("Replicates tag containers to several clients over a lossy simulated connection and "
+		"verifies that they converge.");
+	HelpUsage = TEXT("-run=GTM_ReplicationSoak [-Clients=4] [-Ticks=1800] [-TickRate=30] [-LatencyMs=100] "
+		"[-Loss=0.05] [-ChangesPerTick=2] [-Tags=32] [-Seed=0] [-Output=<Dir>]");
+}
+
+int32 UGTM_ReplicationSoakCommandlet::Main(const FString& Params)
+{
+	int32 NumClients = 4;
+	int32 NumTicks = 1800;
+	int32 TickRate = 30;
+	int32 LatencyMs = 100;
+	float Loss = 0.05f;
+	int32 ChangesPerTick = 2;
+	int32 NumTags = 32;
+	int32 Seed = 0;
+	FParse::Value(*Params, TEXT("Clients="), NumClients);
+	FParse::Value(*Params, TEXT("Ticks="), NumTicks);
+	FParse::Value(*Params, TEXT("TickRate="), TickRate);
+	FParse::Value(*Params, TEXT("LatencyMs="), LatencyMs);
+	FParse::Value(*Params, TEXT("Loss="), Loss);
+	FParse::Value(*Params, TEXT("ChangesPerTick="), ChangesPerTick);
+	FParse::Value(*Params, TEXT("Tags="), NumTags);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	NumClients = FMath::Max(NumClients, 1);
+	TickRate = FMath::Max(TickRate, 1);
+	Loss = FMath::Clamp(Loss, 0.f, 0.95f);
+
+	FString OutputDir = FPaths::ProjectSavedDir() / TEXT("GameplayTagManager");
+	FParse::Value(*Params, TEXT("Output="), OutputDir);
+
+	const TArray<FGameplayTag> Tags = GetRegisteredTags(FMath::Max(NumTags, 1));
+	if (Tags.IsEmpty())
+	{
+		UE_LOG(LogGameplayTagManager, Error, TEXT("The project has no gameplay tags to replicate."));
+		return 1;
+	}
+
+	const double MillisecondsPerTick = 1000.0 / TickRate;
+	const int32 LatencyTicks = FMath::Max(FMath::CeilToInt32(LatencyMs / MillisecondsPerTick), 1);
+
+	// Nothing is allowed to reallocate past this point, delegates point into these arrays
+	TArray<FServerChannel> ServerChannels;
+	ServerChannels.SetNum(NumChannels);
+
+	TArray<FClientChannel> ClientChannels;
+	ClientChannels.SetNum(NumClients * NumChannels);
+
+	for (int32 ChannelIndex = 0; ChannelIndex < NumChannels; ++ChannelIndex)
+	{
+		FServerChannel& Server = ServerChannels[ChannelIndex];
+		Server.Container = FGTM_GameplayTagStackContainer(nullptr, ReplicatedContainerIds[ChannelIndex]);
+		Server.Container.OnInternalsChangedDelegate.BindLambda([&Server]
+		{
+			Server.NumChanges++;
+		});
+	}
+
+	for (int32 ClientIndex = 0; ClientIndex < ClientChannels.Num(); ++ClientIndex)
+	{
+		FClientChannel& Client = ClientChannels[ClientIndex];
+		Client.Container = FGTM_GameplayTagStackContainer(nullptr, ReplicatedContainerIds[ClientIndex % NumChannels]);
+		Client.Container.OnInternalsChangedDelegate.BindLambda([&Client]
+		{
+			Client.NumNotifications++;
+		});
+	}
+
+	FNetSerializationHarness Harness;
+	FRandomStream RandomStream(Seed);
+
+	auto SimulateTick = [&](int32 Tick, bool bMutate, float TickLoss)
+	{
+		if (bMutate)
+		{
+			for (int32 ChangeIndex = 0; ChangeIndex < ChangesPerTick; ++ChangeIndex)
+			{
+				MutateRandomly(RandomStream, ServerChannels[RandomStream.RandHelper(NumChannels)].Container, Tags);
+			}
+		}
+
+		for (int32 ClientIndex = 0; ClientIndex < ClientChannels.Num(); ++ClientIndex)
+		{
+			FClientChannel& Client = ClientChannels[ClientIndex];
+			const FServerChannel& Server = ServerChannels[ClientIndex % NumChannels];
+
+			SendPacket(Harness, RandomStream, ServerChannels[ClientIndex % NumChannels], Client, Tick, LatencyTicks,
+				TickLoss);
+			ReceivePackets(Harness, Client, Tick);
+			UpdateConvergence(Server, Client, Tick, MillisecondsPerTick);
+		}
+	};
+
+	int32 Tick = 0;
+	for (; Tick < NumTicks; ++Tick)
+	{
+		SimulateTick(Tick, true, Loss);
+	}
+
+	// Let everything in flight settle over a clean connection
+	const int32 MaxDrainTicks = LatencyTicks * 4 + TickRate;
+	for (int32 DrainTick = 0; DrainTick < MaxDrainTicks; ++DrainTick, ++Tick)
+	{
+		SimulateTick(Tick, false, 0.f);
+	}
+
+	int32 NumMismatches = 0;
+	FString CsvString = TEXT("Client,Container,Changes,Packets,LostPackets,BytesPerChange,Notifications,"
+		"ConvergenceP50Ms,ConvergenceP99Ms\n");
+
+	for (int32 ClientIndex = 0; ClientIndex < ClientChannels.Num(); ++ClientIndex)
+	{
+		FClientChannel& Client = ClientChannels[ClientIndex];
+		const FServerChannel& Server = ServerChannels[ClientIndex % NumChannels];
+		const TCHAR* ContainerName = LexToString(Server.Container.GetContainerId());
+
+		if (!AreEqual(Server.Container, Client.Container))
+		{
+			NumMismatches++;
+			UE_LOG(LogGameplayTagManager, Error, TEXT("Client %d diverged on the %s container: server [%s], "
+				"client [%s]"), ClientIndex / NumChannels, ContainerName, *Server.Container.GetTags().ToString(),
+				*Client.Container.GetTags().ToString());
+		}
+
+		Client.ConvergenceTimes.Sort();
+		const double BytesPerChange = Client.NumBits / 8.0 / FMath::Max(Server.NumChanges, 1);
+		const double ConvergenceP50 = GetPercentile(Client.ConvergenceTimes, 50.0);
+		const double ConvergenceP99 = GetPercentile(Client.ConvergenceTimes, 99.0);
+
+		UE_LOG(LogGameplayTagManager, Display, TEXT("Client %d %-13s: %5d changes, %5d packets (%4d lost), "
+			"%6.2f B/change, %5d notifications, convergence p50 %.1f ms p99 %.1f ms"), ClientIndex / NumChannels,
+			ContainerName, Server.NumChanges, Client.NumPackets, Client.NumLostPackets, BytesPerChange,
+			Client.NumNotifications, ConvergenceP50, ConvergenceP99);
+
+		CsvString += FString::Printf(TEXT("%d,%s,%d,%d,%d,%.2f,%d,%.2f,%.2f\n"), ClientIndex / NumChannels,
+			ContainerName, Server.NumChanges, Client.NumPackets, Client.NumLostPackets, BytesPerChange,
+			Client.NumNotifications, ConvergenceP50, ConvergenceP99);
+	}
+
+	FFileHelper::SaveStringToFile(CsvString, *(OutputDir / TEXT("ReplicationSoak.csv")));
+
+	if (NumMismatches > 0)
+	{
+		UE_LOG(LogGameplayTagManager, Error, TEXT("%d client containers did not converge."), NumMismatches);
+		return 1;
+	}
+
+	UE_LOG(LogGameplayTagManager, Display, TEXT("All %d clients converged."), NumClients);
+	return 0;
+}
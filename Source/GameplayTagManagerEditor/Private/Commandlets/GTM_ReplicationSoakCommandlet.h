@@ -0,0 +1,32 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "GTM_ReplicationSoakCommandlet.generated.h"
+
+/**
+ * Replicates tag stack containers from a server to several clients in one process, through a simulated connection
+ * with latency and packet loss. Reports convergence latency, bytes per change and client notification counts, and
+ * fails if any client ends up with a different state than the server.
+ *
+ * Usage: UnrealEditor-Cmd.exe <Project> -run=GTM_ReplicationSoak [-Clients=4] [-Ticks=1800] [-TickRate=30]
+ *		[-LatencyMs=100] [-Loss=0.05] [-ChangesPerTick=2] [-Tags=32] [-Seed=0] [-Output=<Dir>]
+ *
+ * Lost packets are never retransmitted as-is; like the fast array replication, the next packet is written against
+ * the last state the client acknowledged, so it carries everything the lost one did.
+ */
+UCLASS()
+class UGTM_ReplicationSoakCommandlet
+	: public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGTM_ReplicationSoakCommandlet();
+
+	//~UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~End of UCommandlet Interface
+};
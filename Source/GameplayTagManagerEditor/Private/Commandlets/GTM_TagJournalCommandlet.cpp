@@ -0,0 +1,126 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Commandlets/GTM_TagJournalCommandlet.h"
+
+#include "Algo/StableSort.h"
+#include "Debug/GTM_TagJournalReader.h"
+#include "Gameplay/Misc/GameplayTagManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	using namespace GameplayTagManager::TagJournal;
+
+	struct FCsvRow
+	{
+	public:
+		FTagChangedRecord Record;
+		FString ManagerName;
+		FString TagName;
+	};
+
+	FString ToCsvLine(const FCsvRow& Row)
+	{
+		return FString::Printf(TEXT("%llu,%.6f,%s,%s,%s,%d,%d\n"), Row.Record.Frame, Row.Record.Time,
+			*Row.TagName, *Row.ManagerName, LexToString(static_cast<EGTM_StackContainerId>(Row.Record.ContainerId)),
+			Row.Record.OldCount, Row.Record.NewCount);
+	}
+}
+
+UGTM_TagJournalCommandlet::UGTM_TagJournalCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+
+	HelpDescription = TEXT("Converts a binary tag journal into CSV, optionally as per-tag timelines.");
+	HelpUsage = TEXT("-run=GTM_TagJournal -Journal=<File.gtmj> [-Output=<File.csv>] [-Timeline] [-Tag=<Tag>] "
+		"[-Manager=<Substring>]");
+}
+
+int32 UGTM_TagJournalCommandlet::Main(const FString& Params)
+{
+	FString JournalPath;
+	if (!FParse::Value(*Params, TEXT("Journal="), JournalPath))
+	{
+		UE_LOG(LogGameplayTagManager, Error, TEXT("Missing -Journal=<File.gtmj>"));
+		return 1;
+	}
+
+	FString OutputPath = FPaths::ChangeExtension(JournalPath, TEXT("csv"));
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	FString TagFilter;
+	FString ManagerFilter;
+	FParse::Value(*Params, TEXT("Tag="), TagFilter);
+	FParse::Value(*Params, TEXT("Manager="), ManagerFilter);
+	const bool bTimeline = FParse::Param(*Params, TEXT("Timeline"));
+
+	FReader Reader;
+	if (!Reader.Open(JournalPath))
+	{
+		return 1;
+	}
+
+	int32 NumRecords = 0;
+	TArray<FCsvRow> Rows;
+	FTagChangedRecord Record;
+	while (Reader.ReadNext(Record))
+	{
+		NumRecords++;
+
+		FCsvRow Row;
+		Row.Record = Record;
+		Row.ManagerName = Reader.GetManagerName(Record.ManagerId);
+		Row.TagName = Reader.GetTagName(Record.TagNetIndex);
+
+		// A parent tag filter also keeps its children
+		const bool bMatchesTag = TagFilter.IsEmpty() || Row.TagName == TagFilter ||
+			Row.TagName.StartsWith(TagFilter + TEXT("."));
+		const bool bMatchesManager = ManagerFilter.IsEmpty() || Row.ManagerName.Contains(ManagerFilter);
+		if (bMatchesTag && bMatchesManager)
+		{
+			Rows.Add(MoveTemp(Row));
+		}
+	}
+
+	if (bTimeline)
+	{
+		// Stable to keep each group in the recorded order
+		Algo::StableSort(Rows, [](const FCsvRow& Lhs, const FCsvRow& Rhs)
+		{
+			if (Lhs.TagName != Rhs.TagName)
+			{
+				return Lhs.TagName < Rhs.TagName;
+			}
+
+			return Lhs.ManagerName < Rhs.ManagerName;
+		});
+	}
+
+	FString CsvString = TEXT("Frame,Seconds,Tag,Manager,Container,OldCount,NewCount\n");
+	for (const FCsvRow& Row : Rows)
+	{
+		CsvString += ToCsvLine(Row);
+	}
+
+	if (!FFileHelper::SaveStringToFile(CsvString, *OutputPath))
+	{
+		UE_LOG(LogGameplayTagManager, Error, TEXT("Failed to write %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogGameplayTagManager, Display, TEXT("Wrote %d of %d tag changes to %s"), Rows.Num(), NumRecords,
+		*OutputPath);
+
+	if (Reader.GetNumDropped() > 0)
+	{
+		UE_LOG(LogGameplayTagManager, Warning, TEXT("The journal is missing %llu tag changes the writer couldn't "
+			"keep up with; raise gtm.Journal.MaxPendingKB"), Reader.GetNumDropped());
+	}
+
+	return 0;
+}
@@ -0,0 +1,30 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "GTM_TagJournalCommandlet.generated.h"
+
+/**
+ * Converts a binary tag journal written by gtm.Journal.Start into CSV.
+ *
+ * Usage: UnrealEditor-Cmd.exe <Project> -run=GTM_TagJournal -Journal=<File.gtmj> [-Output=<File.csv>] [-Timeline]
+ *		[-Tag=<Tag>] [-Manager=<Substring>]
+ *
+ * By default the rows are in the order they were recorded. With -Timeline they're grouped per tag, then per manager,
+ * which reads as the history of each tag.
+ */
+UCLASS()
+class UGTM_TagJournalCommandlet
+	: public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UGTM_TagJournalCommandlet();
+
+	//~UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~End of UCommandlet Interface
+};
@@ -54,8 +54,8 @@ void FGTM_GameplayTagBlueprintPropertyMappingDetails::CustomizeHeader(TSharedRef
 				continue;
 			}
 
-			// Only support booleans, floats, and integers.
-			const bool bIsValidType = Property->IsA(FBoolProperty::StaticClass()) || Property->IsA(FIntProperty::StaticClass()) || Property->IsA(FFloatProperty::StaticClass());
+			// Only support booleans, floats, and integers. Blueprint floats are doubles.
+			const bool bIsValidType = Property->IsA(FBoolProperty::StaticClass()) || Property->IsA(FIntProperty::StaticClass()) || Property->IsA(FFloatProperty::StaticClass()) || Property->IsA(FDoubleProperty::StaticClass());
 			if (!bIsValidType)
 			{
 				continue;
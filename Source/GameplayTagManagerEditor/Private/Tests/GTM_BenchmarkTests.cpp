@@ -0,0 +1,105 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Commandlets/GTM_Benchmark.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+using namespace GameplayTagManager::Benchmark;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGTM_BenchmarkBaselineTest, "GameplayTagManager.Benchmark.Baseline",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGTM_BenchmarkBaselineTest::RunTest(const FString& Parameters)
+{
+	const FString BaselinePath = GetDefaultBaselinePath();
+
+	FBaseline Baseline;
+	if (!TestTrue(FString::Printf(TEXT("Baseline loads from %s"), *BaselinePath), LoadBaseline(BaselinePath, Baseline)))
+	{
+		return false;
+	}
+
+	TestTrue(TEXT("Threshold is positive"), Baseline.Threshold > 0.f);
+
+	if (Baseline.Results.IsEmpty())
+	{
+		AddWarning(TEXT("The baseline has no results yet; record it with -run=GTM_Benchmark -WriteBaseline on the "
+			"reference configuration."));
+		return true;
+	}
+
+	TestFalse(TEXT("Baseline names the configuration it was recorded on"), Baseline.Configuration.IsEmpty());
+
+	auto TestHasResult = [&](const TCHAR* Name, int32 NumTags, int32 NumListeners)
+	{
+		FResult Key;
+		Key.Name = Name;
+		Key.NumTags = NumTags;
+		Key.NumListeners = NumListeners;
+		TestTrue(FString::Printf(TEXT("Baseline has %s"), *Key.GetKey()), Baseline.Results.Contains(Key.GetKey()));
+	};
+
+	// Every case the default run produces must be covered, otherwise a regression in it would pass unnoticed
+	static const TCHAR* ManagerBenchmarks[] =
+	{
+		TEXT("AddStack"), TEXT("RemoveStack"), TEXT("OverrideStack"), TEXT("HasTag"), TEXT("HasAllTags"),
+		TEXT("NotifyTagsChanged"),
+	};
+
+	for (const int32 NumTags : GetDefaultTagCounts())
+	{
+		for (const int32 NumListeners : GetDefaultListenerCounts())
+		{
+			for (const TCHAR* Name : ManagerBenchmarks)
+			{
+				TestHasResult(Name, NumTags, NumListeners);
+			}
+		}
+
+		TestHasResult(TEXT("NetDeltaSerialize_Write"), NumTags, 0);
+		TestHasResult(TEXT("NetDeltaSerialize_Read"), NumTags, 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGTM_BenchmarkHotPathsTest, "GameplayTagManager.Benchmark.HotPaths",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FGTM_BenchmarkHotPathsTest::RunTest(const FString& Parameters)
+{
+	FBaseline Baseline;
+	if (!TestTrue(TEXT("Baseline loads"), LoadBaseline(GetDefaultBaselinePath(), Baseline)))
+	{
+		return false;
+	}
+
+	const TArray<FResult> Results = RunAll(GetDefaultTagCounts(), GetDefaultListenerCounts(), 10000);
+	if (!TestFalse(TEXT("The project has gameplay tags to benchmark with"), Results.IsEmpty()))
+	{
+		return false;
+	}
+
+	for (const FResult& Result : Results)
+	{
+		AddInfo(FString::Printf(TEXT("%s: %.2f ns/op, %.2f B/op"), *Result.GetKey(), Result.NanosecondsPerOp,
+			Result.BytesPerOp));
+	}
+
+	// Wall-clock timings vary between machines and runs, so only the deterministic bytes per operation gate the test
+	const FComparison Comparison = CompareWithBaseline(Results, Baseline);
+	for (const FString& TimingChange : Comparison.TimingChanges)
+	{
+		AddInfo(TimingChange);
+	}
+
+	for (const FString& Regression : Comparison.Regressions)
+	{
+		AddError(Regression);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,20 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Tests/GTM_ReplicationTestActor.h"
+
+#include "Gameplay/Misc/GameplayTagManager.h"
+
+AGTM_ReplicationTestActor::AGTM_ReplicationTestActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	bReplicates = true;
+	bAlwaysRelevant = true;
+
+	GameplayTagManager = CreateDefaultSubobject<UGameplayTagManager>(TEXT("GameplayTagManager"));
+}
+
+UGameplayTagManager* AGTM_ReplicationTestActor::GetGameplayTagManager() const
+{
+	return GameplayTagManager;
+}
@@ -0,0 +1,28 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#pragma once
+
+#include "GameFramework/Actor.h"
+
+#include "GTM_ReplicationTestActor.generated.h"
+
+class UGameplayTagManager;
+
+/**
+ * Always relevant replicated actor with a tag manager, spawned by the replication automation tests.
+ */
+UCLASS(NotBlueprintable, NotPlaceable, Transient)
+class AGTM_ReplicationTestActor
+	: public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AGTM_ReplicationTestActor();
+
+	UGameplayTagManager* GetGameplayTagManager() const;
+
+private:
+	UPROPERTY(VisibleAnywhere, Category="Gameplay Tags")
+	TObjectPtr<UGameplayTagManager> GameplayTagManager;
+};
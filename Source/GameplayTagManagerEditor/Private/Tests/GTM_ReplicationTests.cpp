@@ -0,0 +1,394 @@
+// Author: Antonio Sidenko (Tonetfal), October 2026
+
+#include "Algo/Find.h"
+#include "Commandlets/GTM_CommandletUtils.h"
+#include "Editor.h"
+#include "EngineUtils.h"
+#include "Gameplay/Misc/GameplayTagManager.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/AutomationTest.h"
+#include "Settings/GTM_GameplayTagManagerSettings.h"
+#include "Settings/LevelEditorPlaySettings.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+#include "Tests/GTM_ReplicationTestActor.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	constexpr int32 NumClients = 2;
+	constexpr double ConnectTimeout = 30.0;
+	constexpr double ReplicationTimeout = 10.0;
+
+	/** Time to keep waiting after the expected clients got the tag, so the others get a chance to wrongly get it. */
+	constexpr double SettleTime = 1.0;
+
+	constexpr EGTM_StackContainerId TestedContainerIds[] =
+	{
+		EGTM_StackContainerId::Replicated,
+		EGTM_StackContainerId::OwnerOnly,
+		EGTM_StackContainerId::Custom,
+		EGTM_StackContainerId::Authoritative,
+	};
+
+	struct FClientView
+	{
+	public:
+		UWorld* World = nullptr;
+		AGTM_ReplicationTestActor* Actor = nullptr;
+		bool bIsOwner = false;
+	};
+
+	struct FReplicationTestState
+	{
+	public:
+		FReplicationTestState(FAutomationTestBase& InTest, EGTM_StackContainerId InContainerId)
+			: Test(InTest)
+			, ContainerId(InContainerId)
+		{
+		}
+
+		UWorld* FindServerWorld() const
+		{
+			for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+			{
+				UWorld* World = WorldContext.World();
+				if (WorldContext.WorldType == EWorldType::PIE && World && World->GetNetMode() == NM_DedicatedServer)
+				{
+					return World;
+				}
+			}
+
+			return nullptr;
+		}
+
+		TArray<FClientView> GetClientViews() const
+		{
+			TArray<FClientView> Views;
+			for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+			{
+				UWorld* World = WorldContext.World();
+				if (WorldContext.WorldType != EWorldType::PIE || !World || World->GetNetMode() != NM_Client)
+				{
+					continue;
+				}
+
+				FClientView& View = Views.AddDefaulted_GetRef();
+				View.World = World;
+
+				for (TActorIterator<AGTM_ReplicationTestActor> It(World); It; ++It)
+				{
+					View.Actor = *It;
+
+					// Other clients don't know about the owning controller, so only the owner resolves it
+					const AActor* Owner = View.Actor->GetOwner();
+					View.bIsOwner = Owner && Owner == World->GetFirstPlayerController();
+					break;
+				}
+			}
+
+			return Views;
+		}
+
+		bool IsVisibleTo(const FClientView& View) const
+		{
+			switch (ContainerId)
+			{
+				case EGTM_StackContainerId::OwnerOnly:
+					return View.bIsOwner;
+				case EGTM_StackContainerId::Authoritative:
+					return !View.bIsOwner;
+				case EGTM_StackContainerId::Custom:
+					switch (UGTM_GameplayTagManagerSettings::Get()->CustomChannelCondition)
+					{
+						case EGTM_ReplicationCondition::OwnerOnly:
+							return View.bIsOwner;
+						case EGTM_ReplicationCondition::SkipOwner:
+							return !View.bIsOwner;
+						case EGTM_ReplicationCondition::AutonomousOnly:
+							// The test actor is a simulated proxy on every client
+							return false;
+						case EGTM_ReplicationCondition::Custom:
+							return bCustomChannelActive;
+						default:
+							return true;
+					}
+				default:
+					return true;
+			}
+		}
+
+		bool HasTag(const FClientView& View) const
+		{
+			const UGameplayTagManager* TagManager = View.Actor->GetGameplayTagManager();
+			const FGameplayTagContainer Tags = ContainerId == EGTM_StackContainerId::Authoritative
+				? TagManager->GetAuthoritativeTags()
+				: TagManager->GetReplicatedTags();
+			return Tags.HasTagExact(Tag);
+		}
+
+		/** Returns true once every client has the actor and every client that should have the tag got it. */
+		bool HasExpectedClientsReplicated() const
+		{
+			const TArray<FClientView> Views = GetClientViews();
+			if (Views.Num() < NumClients)
+			{
+				return false;
+			}
+
+			for (const FClientView& View : Views)
+			{
+				if (!View.Actor || (IsVisibleTo(View) && !HasTag(View)))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		void TestVisibility(const TCHAR* Phase) const
+		{
+			int32 NumOwners = 0;
+			for (const FClientView& View : GetClientViews())
+			{
+				if (!View.Actor)
+				{
+					Test.AddError(FString::Printf(TEXT("%s: the test actor never reached client %s"), Phase,
+						*GetNameSafe(View.World)));
+					continue;
+				}
+
+				NumOwners += View.bIsOwner;
+
+				const bool bExpected = IsVisibleTo(View);
+				Test.TestEqual(FString::Printf(TEXT("%s: %s client sees the %s tag"), Phase,
+					View.bIsOwner ? TEXT("owning") : TEXT("non-owning"), LexToString(ContainerId)), HasTag(View),
+					bExpected);
+			}
+
+			Test.TestEqual(FString::Printf(TEXT("%s: number of owning clients"), Phase), NumOwners, 1);
+		}
+
+		void RouteTag()
+		{
+			auto* Settings = GetMutableDefault<UGTM_GameplayTagManagerSettings>();
+			OriginalRoutes = Settings->ReplicationChannelRoutes;
+
+			FGTM_ReplicationChannelRoute& Route = Settings->ReplicationChannelRoutes.AddDefaulted_GetRef();
+			Route.TagRoot = Tag;
+			Route.Channel = ContainerId == EGTM_StackContainerId::OwnerOnly ? EGTM_ReplicationChannel::OwnerOnly
+				: ContainerId == EGTM_StackContainerId::Custom ? EGTM_ReplicationChannel::Custom
+				: EGTM_ReplicationChannel::Default;
+
+			OnRoutesChanged();
+		}
+
+		void RestoreRoutes()
+		{
+			GetMutableDefault<UGTM_GameplayTagManagerSettings>()->ReplicationChannelRoutes = OriginalRoutes;
+			OnRoutesChanged();
+		}
+
+	private:
+		static void OnRoutesChanged()
+		{
+			// Drops the cached routes
+			FPropertyChangedEvent PropertyChangedEvent(FindFProperty<FProperty>(
+				UGTM_GameplayTagManagerSettings::StaticClass(),
+				GET_MEMBER_NAME_CHECKED(UGTM_GameplayTagManagerSettings, ReplicationChannelRoutes)));
+			GetMutableDefault<UGTM_GameplayTagManagerSettings>()->PostEditChangeProperty(PropertyChangedEvent);
+		}
+
+	public:
+		FAutomationTestBase& Test;
+		const EGTM_StackContainerId ContainerId;
+		FGameplayTag Tag;
+
+		TWeakObjectPtr<AGTM_ReplicationTestActor> ServerActor;
+		bool bCustomChannelActive = true;
+		bool bAborted = false;
+
+		double WaitStartTime = 0.0;
+		double ReplicatedTime = 0.0;
+
+	private:
+		TArray<FGTM_ReplicationChannelRoute> OriginalRoutes;
+	};
+
+	using FStatePtr = TSharedRef<FReplicationTestState>;
+
+	/** Waits until the clients got the tag, then checks each of them against the channel's condition. */
+	void AddVerifyVisibilityCommand(const FStatePtr& State, const TCHAR* Phase)
+	{
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([State, Phase]
+		{
+			if (State->bAborted)
+			{
+				return true;
+			}
+
+			const double Now = FPlatformTime::Seconds();
+			if (State->WaitStartTime == 0.0)
+			{
+				State->WaitStartTime = Now;
+			}
+
+			if (State->ReplicatedTime == 0.0 && State->HasExpectedClientsReplicated())
+			{
+				State->ReplicatedTime = Now;
+			}
+
+			const bool bSettled = State->ReplicatedTime != 0.0 && Now - State->ReplicatedTime >= SettleTime;
+			const bool bTimedOut = Now - State->WaitStartTime >= ReplicationTimeout;
+			if (!bSettled && !bTimedOut)
+			{
+				return false;
+			}
+
+			State->TestVisibility(Phase);
+			State->WaitStartTime = 0.0;
+			State->ReplicatedTime = 0.0;
+			return true;
+		}));
+	}
+}
+
+/**
+ * Replicates a tag through a real server and two clients in PIE, and checks that each replication channel reaches
+ * only the clients its condition allows.
+ */
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FGTM_ReplicationConditionsTest, "GameplayTagManager.Replication.Conditions",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+void FGTM_ReplicationConditionsTest::GetTests(TArray<FString>& OutBeautifiedNames,
+	TArray<FString>& OutTestCommands) const
+{
+	for (const EGTM_StackContainerId ContainerId : TestedContainerIds)
+	{
+		OutBeautifiedNames.Add(LexToString(ContainerId));
+		OutTestCommands.Add(LexToString(ContainerId));
+	}
+}
+
+bool FGTM_ReplicationConditionsTest::RunTest(const FString& Parameters)
+{
+	const EGTM_StackContainerId* ContainerId = Algo::FindByPredicate(TestedContainerIds,
+		[&Parameters](EGTM_StackContainerId Id)
+		{
+			return Parameters == LexToString(Id);
+		});
+
+	if (!TestNotNull(TEXT("Known replication channel"), ContainerId))
+	{
+		return false;
+	}
+
+	const FStatePtr State = MakeShared<FReplicationTestState>(*this, *ContainerId);
+
+	const TArray<FGameplayTag> Tags = GameplayTagManager::Commandlets::GetRegisteredTags(1);
+	if (!TestFalse(TEXT("The project has gameplay tags to replicate"), Tags.IsEmpty()))
+	{
+		return false;
+	}
+
+	State->Tag = Tags[0];
+	State->RouteTag();
+
+	FAutomationEditorCommonUtils::CreateNewMap();
+
+	auto* PlaySettings = NewObject<ULevelEditorPlaySettings>();
+	PlaySettings->SetPlayNetMode(EPlayNetMode::PIE_Client);
+	PlaySettings->SetPlayNumberOfClients(NumClients);
+	PlaySettings->SetRunUnderOneProcess(true);
+
+	FRequestPlaySessionParams PlaySessionParams;
+	PlaySessionParams.WorldType = EPlaySessionWorldType::PlayInEditor;
+	PlaySessionParams.EditorPlaySettings = PlaySettings;
+	GEditor->RequestPlaySession(PlaySessionParams);
+
+	// Wait for every client to get its player controller on the server
+	const double ConnectStartTime = FPlatformTime::Seconds();
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([State, ConnectStartTime]
+	{
+		const UWorld* ServerWorld = State->FindServerWorld();
+		if (ServerWorld && ServerWorld->GetNumPlayerControllers() >= NumClients)
+		{
+			return true;
+		}
+
+		if (FPlatformTime::Seconds() - ConnectStartTime >= ConnectTimeout)
+		{
+			State->Test.AddError(TEXT("Clients failed to connect to the server"));
+			State->bAborted = true;
+			return true;
+		}
+
+		return false;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([State]
+	{
+		if (State->bAborted)
+		{
+			return true;
+		}
+
+		UWorld* ServerWorld = State->FindServerWorld();
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.Owner = ServerWorld->GetFirstPlayerController();
+		AGTM_ReplicationTestActor* Actor = ServerWorld->SpawnActor<AGTM_ReplicationTestActor>(SpawnParameters);
+		State->ServerActor = Actor;
+
+		UGameplayTagManager* TagManager = Actor->GetGameplayTagManager();
+		if (State->ContainerId == EGTM_StackContainerId::Custom &&
+			UGTM_GameplayTagManagerSettings::Get()->CustomChannelCondition == EGTM_ReplicationCondition::Custom)
+		{
+			State->bCustomChannelActive = false;
+			TagManager->SetCustomReplicationChannelActive(false);
+		}
+
+		if (State->ContainerId == EGTM_StackContainerId::Authoritative)
+		{
+			TagManager->AddAuthoritativeTag(State->Tag);
+		}
+		else
+		{
+			TagManager->AddTag(State->Tag);
+		}
+
+		return true;
+	}));
+
+	AddVerifyVisibilityCommand(State, TEXT("Initial"));
+
+	if (State->ContainerId == EGTM_StackContainerId::Custom &&
+		UGTM_GameplayTagManagerSettings::Get()->CustomChannelCondition == EGTM_ReplicationCondition::Custom)
+	{
+		ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([State]
+		{
+			if (!State->bAborted && State->ServerActor.IsValid())
+			{
+				State->bCustomChannelActive = true;
+				State->ServerActor->GetGameplayTagManager()->SetCustomReplicationChannelActive(true);
+			}
+
+			return true;
+		}));
+
+		AddVerifyVisibilityCommand(State, TEXT("Activated"));
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand());
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([State]
+	{
+		State->RestoreRoutes();
+		return true;
+	}));
+
+	return true;
+}
+
+#endif